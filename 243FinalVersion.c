@@ -1,1297 +1,6 @@
 /* ************************************************* Definition Area ************************************************** */
 
-#define BOARD                 "DE1-SoC"
+// Final demo build: the engine of Project_BattleOfBalls.c with the 60/120 speed ladder
+#define GAME_VARIANT VARIANT_FINAL
 
-/* Memory */
-#define DDR_BASE              0x00000000
-#define DDR_END               0x3FFFFFFF
-#define A9_ONCHIP_BASE        0xFFFF0000
-#define A9_ONCHIP_END         0xFFFFFFFF
-#define SDRAM_BASE            0xC0000000  // Memory 1
-#define SDRAM_END             0xC3FFFFFF
-#define FPGA_ONCHIP_BASE      0xC8000000  // Memory 2
-#define FPGA_ONCHIP_END       0xC803FFFF
-#define FPGA_CHAR_BASE        0xC9000000  // Text Showing Base Address
-#define FPGA_CHAR_END         0xC9001FFF
-
-/* Cyclone V FPGA devices */
-#define LEDR_BASE             0xFF200000
-#define HEX3_HEX0_BASE        0xFF200020
-#define HEX5_HEX4_BASE        0xFF200030
-#define SW_BASE               0xFF200040
-#define KEY_BASE              0xFF200050
-#define JP1_BASE              0xFF200060
-#define JP2_BASE              0xFF200070
-#define PS2_BASE              0xFF200100  // Keyboard/Mouse Input Base Address
-#define PS2_DUAL_BASE         0xFF200108
-#define JTAG_UART_BASE        0xFF201000
-#define JTAG_UART_2_BASE      0xFF201008
-#define IrDA_BASE             0xFF201020
-#define TIMER_BASE            0xFF202000
-#define AV_CONFIG_BASE        0xFF203000
-#define PIXEL_BUF_CTRL_BASE   0xFF203020  // Draw Pixel Base Address
-#define CHAR_BUF_CTRL_BASE    0xFF203030
-#define AUDIO_BASE            0xFF203040  // Audio Base
-#define VIDEO_IN_BASE         0xFF203060
-#define ADC_BASE              0xFF204000
-
-/* Cyclone V HPS devices */
-#define HPS_GPIO1_BASE        0xFF709000
-#define HPS_TIMER0_BASE       0xFFC08000
-#define HPS_TIMER1_BASE       0xFFC09000
-#define HPS_TIMER2_BASE       0xFFD00000
-#define HPS_TIMER3_BASE       0xFFD01000
-#define FPGA_BRIDGE           0xFFD0501C
-
-/* ARM A9 MPCORE devices */
-#define   PERIPH_BASE         0xFFFEC000    // base address of peripheral devices
-#define   MPCORE_PRIV_TIMER   0xFFFEC600    // PERIPH_BASE + 0x0600
-
-/* Interrupt controller (GIC) CPU interface(s) */
-#define MPCORE_GIC_CPUIF      0xFFFEC100    // PERIPH_BASE + 0x100
-#define ICCICR                0x00          // offset to CPU interface control reg
-#define ICCPMR                0x04          // offset to interrupt priority mask reg
-#define ICCIAR                0x0C          // offset to interrupt acknowledge reg
-#define ICCEOIR               0x10          // offset to end of interrupt reg
-/* Interrupt controller (GIC) distributor interface(s) */
-#define MPCORE_GIC_DIST       0xFFFED000    // PERIPH_BASE + 0x1000
-#define ICDDCR                0x00          // offset to distributor control reg
-#define ICDISER               0x100         // offset to interrupt set-enable regs
-#define ICDICER               0x180         // offset to interrupt clear-enable regs
-#define ICDIPTR               0x800         // offset to interrupt processor targets regs
-#define ICDICFR               0xC00         // offset to interrupt configuration regs
-
-/* VGA Colors */
-#define BLACK 0x0000
-#define WHITE 0xFFFF
-#define YELLOW 0xFFE0
-#define RED 0xF800
-#define GREEN 0x07E0
-#define BLUE 0x001F
-#define CYAN 0x07FF
-#define MAGENTA 0xF81F
-#define GREY 0xC618
-#define PINK 0xFC18
-#define ORANGE 0xFC00
-
-/* Absolute Value */
-#define ABS(x) (((x) > 0) ? (x) : -(x))
-
-/* Screen size */
-#define RESOLUTION_X 320
-#define RESOLUTION_Y 240
-
-/* Number of Balls */
-#define FOOD_NUM 50
-#define AI_NUM 10
-
-/* ************************************************** Global Area ***************************************************** */
-#include <time.h>
-#include <math.h>
-#include <stdlib.h>
-#include <stdio.h>
-#include <stdbool.h>
-#include <string.h>
-    
-/* Type Definition of Balls */
-typedef struct ourBall{
-    bool isEaten;    // Eaten/Dead = 1
-                     // Alive = 0
-    short int color;
-    int radius;
-    int score;
-    
-    int xLocation;
-    int yLocation;
-    
-    int lastXLocation;
-    int lastYLocation;
-} Ball;
-
-/* Function Prototypes */
-void wait_for_vsync();
-
-void initial_game();
-void initial_memory_base();
-void initial_player();
-void initial_AI();
-void initial_food();
-void initial_score();
-
-void keyboard_input();
-void up_input();
-void right_input();
-void left_input();
-void down_input();
-void start_input();
-void pause_input();
-
-void plot_game();
-void plot_food();
-void plot_AI();
-void plot_player();
-void clear_screen();
-void menu_screen();
-void plot_pixel(int, int, short int);
-void plot_circle(Ball);
-void draw_line(int, int, int, int, short int);
-
-void video_text(int, int, char *);
-void cleartext();
-void display_score();
-void update_score();
-void draw_pic_a();
-void draw_pic_b();
-void draw_pic_c();
-void draw_pic_d();
-void display_pausetext();
-void display_endingtext();
-
-void update_game();
-void AI_update();
-void AIChase(Ball *, Ball *);
-
-void game_react();
-void playerEatFood();
-void AIEatFood();
-void playerEatAI();
-
-void opening();
-void ending();
-
-float findDistance(Ball, Ball);
-float findDistanceForPlayer(Ball, int, int);
-bool overlapPlayer(Ball);
-bool overlapAI(Ball);
-void swap(int*, int*);
-
-
-/* Global Variables */
-Ball player;         // Ball of Player
-Ball AI[AI_NUM];     // Ball Array of AI
-Ball food[FOOD_NUM]; // Ball Array of Food
-
-bool endGame = false;
-bool pauseGame = false;
-bool startGame = false;
-bool restartGame = false;
-
-short int color[9] = {RED, YELLOW, GREEN, BLUE, CYAN, MAGENTA, GREY, PINK, ORANGE};
-char byte1 = 0, byte2 = 0, byte3 = 0;
-
-volatile int pixel_buffer_start;
-volatile int * PS2_ptr = (int *)PS2_BASE;
-volatile int * pixel_ctrl_ptr = (int *)PIXEL_BUF_CTRL_BASE;
-volatile int * audio_ptr = (int*)AUDIO_BASE;
-/*PNG array*/
-const uint16_t battle_of_balls[150][276] = {
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61340,50869,40333,44560,59258,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,55031,46673,36200,34147,38370,32066,36200,55031,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59226,46674,38282,34115,38338,48834,55139,59331,55107,38338,29956,46706,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59259,50869,40396,34149,34177,46722,55107,59331,59331,59331,59331,59331,57219,44610,29986,40397,59227,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,55063,34119,34146,42562,53026,59299,59331,59331,59331,59299,59299,59300,59299,59331,59331,50947,34146,34119,55063,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44591,36225,57219,61383,63437,59302,57252,59300,57252,57220,57220,57252,57252,57252,59299,59331,55139,38370,29956,44592,63421,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44591,36289,59302,63479,65533,59308,55172,55173,57221,57221,57221,57220,57221,57220,57220,57252,59331,57251,46722,32034,40396,59227,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44624,36289,61359,65535,63447,57192,55141,55173,55173,55173,57221,57221,57221,57221,57220,57221,57220,59300,59331,50914,29953,44560,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44624,36257,61359,65497,57194,55141,55142,55141,55141,55141,55141,55173,55173,55173,55173,55173,55173,57221,59300,57187,32065,42446,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44624,36289,57221,59271,55142,53094,55142,55142,55141,55141,55141,55141,55141,55141,55141,55141,55141,55173,57252,55139,29985,46705,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44592,36289,57220,57220,53094,53062,53094,53094,53094,55142,55142,55142,55141,55141,55141,55141,55141,55141,57252,55107,29953,48785,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,62958,60712,60745,62860,63123,65304,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65370,62860,62793,62793,62893,63090,63223,65337,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44591,36289,55140,57220,53094,53062,53062,53094,53094,53094,53094,55142,53094,55142,55142,55142,55142,55141,57252,55107,29953,48786,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63058,60480,60512,60480,60448,60448,60514,60679,62893,63124,65370,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,62760,60480,60480,60448,60448,60480,60513,60547,60679,62859,62926,63091,65337,65403,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44591,36289,55141,57221,53094,53062,53062,53062,53062,53062,53094,53094,53094,53094,53094,53094,53094,55141,57252,53059,29954,48753,65436,65469,65469,65469,65470,65502,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,60745,60480,62989,63185,63022,60777,60579,60513,60448,60481,60547,60712,62958,63124,65403,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65337,60546,60544,63053,63055,62924,60776,60611,60514,60480,60448,60448,60480,60546,60613,62794,62926,63025,63223,65403,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65469,65436,65435,65304,63124,63058,63025,62992,62992,63025,63025,63025,63059,63157,65337,65436,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44624,36289,57220,57220,55141,53062,53062,53062,53062,53062,53062,53062,53061,53061,53061,53061,53061,53093,57252,53027,27874,48389,62727,62793,62793,60745,60746,60779,62860,62926,62958,62959,62991,62992,63057,63058,63058,63124,63190,65304,65403,65435,65436,65436,65436,65436,65436,65469,65370,60612,60512,65332,65530,65530,65497,65431,63219,63022,60776,60579,60480,60448,60481,60580,60745,62959,63190,65436,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63092,60481,60611,65431,65530,65530,65497,65431,65333,63154,63022,62890,60677,60546,60513,60480,60448,60480,60514,60580,60679,62893,63025,63190,65403,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,65403,63190,63058,62992,62826,60679,60581,60548,60514,60449,60416,60416,60416,60416,60416,60416,60416,60449,60449,60514,60580,60679,62893,63091,65337,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44624,36225,57220,55141,55173,55141,53062,53062,53062,53062,53062,53061,53061,53061,53061,53061,53061,53093,59300,50947,27842,50307,60480,60481,60480,60480,60480,60480,60448,60448,60448,60448,60448,60448,60448,60448,60480,60481,60513,60546,60547,60579,60580,60612,60612,60613,60678,60712,60679,60481,60612,65399,65529,65529,65529,65529,65530,65530,65497,65398,63154,62956,60711,60545,60480,60448,60514,60646,62892,63090,65337,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62991,60448,60711,65464,65530,65530,65530,65530,65530,65530,65530,65497,65464,65398,63187,63022,62859,60711,60578,60512,60480,60480,60480,60514,60612,60712,62926,63090,63223,65436,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65502,65337,63124,62959,60680,60548,60482,60416,60416,60416,60416,60480,60547,60646,60712,60745,62825,62890,62890,62890,62858,62825,60745,60679,60580,60481,60416,60416,60417,60547,60713,63058,65403,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65437,63190,63124,63124,63124,63157,63158,63157,63157,63157,63158,63190,48588,27905,46723,57220,55173,55141,55141,53094,53062,53061,53061,53061,53061,53061,53061,53061,53061,53093,57252,50915,27874,56975,65268,63219,63219,63153,63121,63088,63023,62990,62957,62955,62922,62890,62857,62825,60776,60744,60711,60711,60678,60613,60546,60512,60480,60480,60480,60480,60480,60416,60744,65495,63473,63474,65493,65527,65529,65529,65530,65530,65530,65530,65464,65365,63088,62858,60645,60480,60448,60480,60547,60712,62991,63190,65436,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62860,60448,60777,65496,65525,65525,65527,65528,65529,65530,65530,65530,65530,65530,65530,65530,65529,65464,65398,63219,63056,62890,60743,60578,60480,60480,60480,60480,60546,60645,60712,62925,63091,63158,65403,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65403,63190,62959,60680,60515,60417,60416,60416,60482,60614,60744,62957,63120,63186,65332,65398,65463,65496,65528,65529,65529,65529,65529,65529,65528,65496,65464,65430,65332,63186,62957,60712,60515,60416,60416,60613,62959,65370,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,62827,60482,60449,60448,60417,60449,60481,60449,60449,60449,60481,60482,58433,42113,27841,38370,55140,57221,55141,55173,53093,53061,53061,53061,53061,53061,53061,53061,53061,55141,59300,48834,29955,61269,65530,65529,65529,65530,65530,65530,65530,65530,65529,65529,65529,65529,65529,65529,65497,65496,65464,65464,65431,65399,65398,65365,65333,65332,65300,63154,60613,60416,62955,65527,63437,63436,63405,63437,63439,63442,65525,65527,65529,65529,65530,65530,65530,65529,65431,63219,63022,60776,60579,60480,60448,60513,60645,62826,63090,63256,65470,65535,65535,65535,65535,65535,65535,65436,63157,62992,62991,62992,62960,62993,63058,63157,63157,63157,63157,63157,63157,63190,63190,63223,63223,63223,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,60679,60448,62923,65527,63438,63437,63437,63438,63440,63442,65524,65526,65527,65529,65529,65530,65530,65530,65530,65530,65530,65530,65464,65398,63219,63055,62858,60711,60579,60480,60448,60480,60448,60513,60613,62792,62925,63124,65304,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65436,63190,62893,60614,60449,60416,60416,60547,60679,62956,63153,65364,65463,65528,65528,65529,65529,65529,65529,65528,65529,65528,65528,65528,65528,65529,65529,65529,65529,65529,65529,65529,65529,65529,65496,65365,63055,60647,60449,60416,60613,63058,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63091,60449,60513,60710,60678,60678,60646,60646,60678,60646,60614,60614,60614,60614,60613,46342,29955,32097,50947,57252,55141,55141,55141,53061,53061,53061,53061,55141,55141,57220,59300,59331,46754,29923,61268,65528,65528,65528,65529,65528,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65530,65530,65530,65529,65530,65397,60546,60448,63153,65525,63436,63404,63404,63404,63436,63436,63436,63438,63440,65523,65525,65528,65529,65529,65530,65530,65530,65497,65398,63153,62891,60677,60513,60448,60448,60547,60712,62926,63190,65403,65535,65535,65470,62859,60513,60480,60480,60480,60448,60480,60480,60480,60480,60480,60480,60480,60480,60513,60513,60514,60514,60546,62792,65370,65535,65535,65535,65535,65535,65535,65535,65535,65535,65370,60579,60480,63020,65527,63437,63436,63436,63436,63436,63436,63436,63437,63438,63439,63441,63475,65525,65527,65528,65529,65530,65530,65530,65530,65530,65530,65530,65497,65366,63219,63088,62858,60678,60579,60480,60448,60480,60480,60546,60646,62827,62959,63157,65304,65403,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,63124,60614,60417,60384,60449,60581,62892,63153,65397,65496,65528,65528,65528,65528,65528,65528,65528,65528,65527,65527,65526,65493,65492,65491,63410,63442,63441,63410,63442,63442,65491,65492,65493,65526,65527,65528,65529,65529,65463,63153,60680,60416,60449,62827,65370,65535,65535,65535,65535,65535,65535,65535,65535,65469,60745,60416,63022,65529,65528,65528,65496,65496,65496,65496,65464,65464,65464,65463,65431,65431,59187,36232,27905,44642,57219,55173,55141,55141,55141,55173,57252,59299,59331,57219,50947,42530,29985,34116,61293,63439,63439,63439,63439,63439,63440,63440,63440,63440,63441,63441,63442,63443,63443,65492,65524,65525,65525,65525,65526,65526,65526,65527,65527,65528,63120,60448,60545,65332,63442,63436,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63438,63441,65524,65526,65528,65529,65529,65530,65530,65530,65464,63252,63055,60776,60611,60480,60448,60481,60613,62826,63024,63091,60546,60546,62891,62956,62956,62924,62892,62892,62859,62859,62858,60778,60776,60743,60741,60709,60677,60677,60579,60480,62959,65535,65535,65535,65535,65535,65535,65535,65535,65535,63223,60513,60512,63151,65526,63437,63436,63437,63437,63437,63437,63437,63437,63436,63436,63436,63436,63436,63437,63439,63440,63443,65525,65526,65528,65529,65530,65530,65530,65530,65530,65530,65530,65496,65398,63218,63055,62890,60677,60547,60480,60448,60480,60480,60546,60645,62826,63025,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65304,60548,60416,60549,62924,63218,65431,65528,65528,65528,65528,65528,65528,65528,65526,65525,65491,63409,63408,63407,63374,63373,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63373,63406,63408,63411,65526,65528,65529,65463,63023,60515,60416,60679,65337,65535,65535,65535,65535,65535,65535,65535,63223,60514,60515,65366,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,65529,63383,48685,27874,38337,55107,57252,57252,59300,59299,57219,50947,40482,32097,27874,32067,42471,55082,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63404,63404,63404,63436,63436,63437,63437,63406,63438,63406,60806,60416,60676,65430,63440,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63437,63439,63441,65525,65527,65529,65529,65530,65530,65530,65529,65399,63186,62957,60677,60546,60448,60448,60481,60480,60645,65464,65530,65530,65530,65530,65530,65530,65530,65529,65529,65529,65497,65497,65497,65497,65497,63088,60480,62925,65535,65535,65535,65535,65535,65535,65535,65535,65535,63025,60448,60544,63218,63477,63436,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63436,63436,63436,63436,63437,63439,63473,63443,65525,65527,65528,65529,65530,65530,65530,65530,65530,65530,65529,65464,65366,63186,63022,62857,60612,60546,60480,60480,60480,62859,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {63025,60417,60614,65398,65528,65528,65528,65528,65528,65528,65526,65492,63409,63407,63373,63372,63372,63340,63340,63340,63340,63340,63340,63372,63372,63372,63372,63340,63340,63372,63372,63372,63372,63372,63372,63372,63372,63340,63373,63407,63443,65527,65528,63219,60612,60384,60647,65338,65535,65535,65535,65535,65535,65535,62959,60416,60778,65528,65528,65492,65492,65492,65492,65492,65493,65493,65493,65493,65493,65525,65526,65526,65526,65494,52942,32003,32065,50914,55139,48834,40450,32065,27874,34083,42470,52937,61291,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63339,60578,60416,62889,65494,63438,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63438,63440,63474,65526,65528,65529,65529,65530,65530,65529,65464,65333,63055,60809,60578,60480,60612,65431,65530,65529,65529,65530,65529,65529,65530,65530,65530,65530,65530,65530,65530,65530,65530,63121,60480,62925,65535,65535,65535,65535,65535,65535,65535,65535,65535,62860,60416,60577,65332,63475,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63436,63436,63436,63436,63437,63438,63473,63443,65525,65527,65528,65529,65530,65530,65530,65530,65530,65530,65497,65463,65333,63153,62923,60513,60580,65338,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {63025,60384,60647,65495,65528,65528,65527,65493,63410,63376,63341,63372,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,63374,63410,65527,65364,60581,60352,60714,65469,65535,65535,65535,65535,65403,60613,60449,63154,65529,65492,63404,63372,63372,63372,63372,63404,63372,63372,63372,63372,63372,63372,63372,63372,63404,63405,57099,36229,27905,32065,27841,34019,42470,52937,59243,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,61129,60416,60448,63052,65493,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63437,63439,63473,65524,65527,65529,65529,65529,65530,65530,65497,63219,60513,60579,65398,65525,63474,63474,63474,63474,63474,63474,63474,63475,63475,63475,63475,63476,63476,63477,63086,60480,62893,65535,65535,65535,65535,65535,65535,65535,65535,65437,60679,60416,60642,65398,63474,63436,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63436,63436,63436,63436,63437,63439,63441,63475,65525,65527,65529,65529,65530,65530,65530,65530,65530,63219,60512,60613,65403,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {62992,60384,60613,65430,65494,63410,63375,63340,63340,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63374,65493,65299,60515,60417,62993,65535,65535,65535,65535,63091,60417,60646,65431,65528,63408,63372,63372,63404,63372,63372,63404,63372,63404,63372,63372,63372,63372,63372,63372,63372,63404,63404,61292,50824,46599,54402,58465,63210,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60968,60384,60512,63184,63444,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63437,63440,63475,65526,65528,65529,65530,65333,60514,60544,65332,63473,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63469,61032,60480,62892,65535,65535,65535,65535,65535,65535,65535,65535,65337,60547,60448,60706,65462,63441,63436,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63436,63436,63436,63437,63437,63439,63473,63475,65526,65528,65529,65530,63022,60448,60745,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {62959,60352,60548,65364,63342,63339,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63341,63443,63088,60416,60548,65338,65535,65535,65502,60779,60384,63022,65529,65526,63373,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,60773,60384,60870,63404,63404,63404,63372,63372,63372,63404,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60773,60384,60577,65332,63441,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63437,63438,63441,65524,63250,60514,60512,65331,63475,63436,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63469,61032,60480,62892,65535,65535,65535,65535,65535,65535,65535,65535,65304,60514,60448,60805,65463,63440,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63404,63404,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63436,63436,63436,63436,63437,63438,63439,63441,60775,60448,62892,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {62895,60352,60514,63283,63374,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63377,60679,60384,63025,65535,65535,65337,60483,60450,65365,65528,63442,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,61065,60416,60577,63307,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63372,63372,63404,63340,60579,60384,60674,65429,63407,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63243,60545,60480,63217,63444,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63469,61032,60480,62892,65535,65535,65535,65535,65535,65535,65535,65535,63223,60481,60480,62920,65495,63406,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63437,63436,63468,63339,60609,60480,63058,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60748,60352,60480,65329,63375,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,63308,63340,63340,63340,63340,63340,63340,63340,63340,63340,63339,63341,63019,60384,60746,65502,65535,62992,60384,60745,65496,65527,63374,63340,63340,63340,63340,63340,63340,63372,63340,63340,63372,63372,63340,63372,63340,63372,63372,63372,63372,63372,63372,63372,63339,60610,60384,60968,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,61194,60481,60416,60806,65462,63373,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,61194,60513,60480,63185,65525,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,61032,60448,62860,65535,65535,65535,65535,65535,65535,65535,65535,63026,60416,60480,62987,65495,63405,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63436,63437,63437,63469,61129,60512,60513,63223,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60649,60352,60480,63216,63376,63307,63307,63307,63307,63308,63308,63308,63307,63307,63308,63308,63307,63307,63307,63307,63307,63308,63308,63308,63340,63340,63340,63340,63340,63340,63340,63340,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,61130,60416,60516,65403,65469,60647,60384,63088,65528,65492,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,60903,60352,60676,63340,63372,63340,63340,63372,63372,63340,63372,63340,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,61064,60384,60416,62987,65493,63373,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,61194,60481,60480,63119,65525,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63437,60999,60416,62827,65502,65535,65535,65535,65535,65535,65535,65535,62927,60416,60480,63052,65526,63405,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,60966,60480,60579,65337,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60584,60352,60512,63151,63377,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63275,63242,61162,61097,61064,61032,61000,61032,61064,61129,63242,63307,63308,63308,63307,63307,63307,63307,63308,63308,63308,63308,63307,63308,63308,63340,63275,60546,60418,63224,63223,60450,60548,65430,65528,63376,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,61162,60449,60448,61130,63372,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,63372,63340,63372,63340,63372,63372,60871,60352,60480,62921,63247,63274,63339,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,61194,60481,60480,63021,65526,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63437,61000,60448,62827,65502,65535,65535,65535,65535,65535,65535,65535,62861,60416,60512,63118,65493,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63404,63404,63436,63436,63436,63436,63404,60772,60448,60679,65437,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60583,58272,60480,63053,63377,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,61064,60837,60772,60706,60640,60608,60608,60608,60608,60608,60608,60608,60674,60837,61097,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63275,60644,60352,63059,62894,60352,60811,65528,65494,63341,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60708,60352,60838,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63307,63307,60708,60352,60544,60640,60640,60705,60771,60868,60966,61096,63242,63307,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61194,60481,60480,62954,65526,63437,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63437,61000,60448,62794,65502,65535,65535,65535,65535,65535,65535,65535,60745,60416,60544,63185,63476,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61226,63145,63274,63306,63339,63372,63404,63404,63436,63436,63436,63436,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63339,60641,60416,62859,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60517,58272,60512,62955,65458,63275,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,60868,60544,60544,60576,60576,60576,60576,60608,60608,60608,60608,60608,60576,60544,60609,60999,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,60709,60352,62862,60582,60385,63153,65528,63410,63308,63308,63308,63308,63308,63308,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,61000,60384,60546,63275,63372,63340,63340,63340,63340,63340,63340,63339,63339,63307,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60999,60771,60738,60448,60384,60576,60640,60640,60640,60640,60608,60608,60640,60673,60738,60836,60966,61064,61162,63307,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61194,60513,60480,62918,65526,63405,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,60967,60416,60746,65502,65535,65535,65535,65535,65535,65535,65535,60712,60384,60577,63251,63443,63372,63372,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60966,60672,60705,60737,60769,60803,60901,60966,61030,61096,63209,63274,63339,63371,63372,63404,63436,63436,63437,63436,63436,63436,63404,63404,63404,63436,63209,60544,60416,62959,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60452,58272,60512,62855,65459,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63308,60869,60576,60576,60576,60576,60576,60608,60608,60608,60608,60576,60608,60576,60576,60544,60673,63210,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,60709,58272,60549,60385,60549,65462,65527,63374,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,61227,60546,60352,60837,61031,60966,60934,60934,60901,60869,60836,60804,60738,60803,63275,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60901,60608,60576,60384,60384,60608,60640,60640,60640,60640,60640,60640,60640,60640,60640,60608,60608,60640,60673,60737,60803,61032,63340,63372,63372,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63404,63404,63307,60545,60448,62854,65495,63406,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,60968,60416,60747,65502,65535,65535,65535,65535,65535,65535,65436,60582,60384,60642,65365,63441,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63372,63404,63340,60803,60672,60672,60672,60672,60672,60672,60640,60672,60672,60704,60705,60737,60769,60803,60869,60966,61063,61096,63209,63274,63339,63372,63404,63404,63437,60966,60480,60449,63157,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60550,58272,60512,60773,65459,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60869,60576,60576,60576,60576,60576,60608,60608,60608,60608,60608,60608,60576,60576,60576,60608,63146,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60676,58272,60417,58272,62924,65527,65493,63308,63307,63307,63307,63307,63308,63308,63307,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,60806,60352,60448,60576,60576,60576,60576,60576,60576,60576,60576,60576,60673,63274,63340,63308,63308,63308,63308,63308,63308,63308,63340,63308,63308,63308,63340,63339,60869,60640,60576,60352,60416,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60608,60869,63340,63340,63340,63340,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63307,60545,60416,60773,65462,63407,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60999,60416,62860,65535,65535,65535,65535,65535,65535,65535,65337,60515,60384,60675,65397,63408,63339,63340,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63274,60737,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60640,60672,60704,60737,60770,60802,60836,60901,60999,60770,60448,60514,65337,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60649,58272,60480,60709,65395,63276,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60902,60576,60576,60576,60576,60576,60608,60608,60608,60608,60608,60608,60576,60576,60576,60709,63313,63276,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,60579,58240,60352,60418,63218,65527,63377,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63308,63307,63308,61098,60417,60384,60544,60608,60608,60608,60608,60608,60608,60608,60608,60706,63244,63340,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63307,60804,60640,60512,60352,60480,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60999,63372,63340,63340,63340,63340,63340,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,63404,63404,63404,63339,60610,60384,60740,65430,63407,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60967,60416,62827,65503,65535,65535,65535,65535,65535,65535,65304,60483,60416,60740,65462,63407,63340,63340,63340,63340,63340,63340,63340,63372,63372,63372,63372,63372,63372,61096,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60608,60448,60614,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {60749,58240,60448,60643,63315,63277,63243,63243,63243,63275,63243,63243,63243,63275,63243,63243,63243,63243,63275,60902,60576,60576,60576,60576,60576,60608,60608,60608,60608,60608,60608,60576,60576,60577,63087,65527,63343,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,61130,60449,58240,58272,60614,65494,65526,63310,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63275,60644,60320,60480,60608,60608,60608,60608,60608,60608,60608,60608,60675,65396,63343,63307,63307,63307,63307,63308,63307,63307,63308,63307,63307,63308,63308,63275,60771,60608,60448,60320,60512,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60641,63215,63375,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,63307,60934,60999,61096,61194,63307,63339,60708,60384,60675,65397,63440,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60934,60416,60746,65502,65535,65535,65535,65535,65535,65535,63190,60417,60416,62854,65494,63374,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,60998,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60544,60416,60779,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {62896,58240,60416,60610,63282,63277,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,60902,60576,60576,60576,60576,60576,60608,60608,60608,60608,60608,60608,60576,60610,63053,65494,65526,63344,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,60967,60384,58272,58240,62990,65527,65459,63276,63275,63275,63275,63275,63275,63275,63275,63307,63307,63307,63307,63307,63243,61130,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,60936,60352,60416,60576,60608,60608,60608,60608,60608,60608,60608,60675,65396,63343,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63275,60738,60608,60384,58272,60544,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60674,65397,63343,63307,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,61096,60640,60640,60640,60672,60738,60803,60545,60384,60642,65364,63441,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,60935,60416,60746,65502,65535,65535,65535,65535,65535,65535,63157,60385,60416,62921,65494,63341,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60835,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60480,60416,62959,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {62961,58241,60384,60577,63217,63310,63210,63211,63211,63211,63243,63243,63243,63243,63243,63243,63243,63243,63243,60902,60576,60576,60576,60576,60576,60608,60608,60608,60576,60576,60609,62855,63217,65526,65526,65526,63277,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,60740,60352,58240,60386,65299,65527,63344,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,60967,60805,63275,63307,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,61162,60482,60320,60512,60608,60608,60608,60608,60608,60608,60608,60675,65364,63343,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63242,60737,60608,60352,58304,60576,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60608,60772,65461,63341,63307,63308,63308,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60934,60608,60640,60640,60640,60640,60640,60512,60384,60576,63250,63441,63340,63340,63340,63372,63372,63372,63340,63340,63340,63340,63340,63340,63372,60935,60384,60747,65502,65535,65535,65535,65535,65535,65535,62994,60352,60416,62987,65494,63340,63308,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63307,60836,60705,60673,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60640,60448,60482,63223,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {63027,58273,58304,60544,63183,63343,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60902,60576,60576,60576,60544,60576,60576,60608,60641,60774,63018,63249,65493,65526,65526,65526,63377,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,61000,60545,60352,58240,60615,65494,65494,63309,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,60739,60609,61097,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60774,58240,60416,60608,60608,60608,60608,60608,60608,60608,60675,65364,63343,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63210,60704,60576,58272,60352,60608,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60608,62954,65461,63340,63307,63308,63308,63308,63308,63340,63340,63340,63340,63340,63340,63340,63307,60770,60608,60640,60640,60640,60640,60640,60512,60352,60512,63184,63442,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,60934,60384,60747,65502,65535,65535,65535,65535,65535,65535,62829,60352,60480,63086,65493,63340,63308,63308,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63307,63312,63251,63118,63018,62888,60772,60705,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60608,60416,60614,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {63125,60386,58272,60512,63118,63343,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60935,60609,60676,60709,62822,62887,62987,63151,65362,65461,65526,65526,65526,65526,65526,63377,63244,63211,63211,63211,63211,63211,63211,63211,63211,63243,63178,60707,60512,58304,58240,63022,65527,65459,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61032,60576,60544,60838,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61033,58305,58304,60576,60608,60608,60608,60608,60608,60608,60674,65363,63343,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63178,60672,60544,58272,58304,60512,60576,60608,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60640,60608,63052,65459,63308,63307,63307,63308,63308,63308,63308,63308,63308,63308,63308,63340,63340,63177,60673,60640,60640,60640,60640,60640,60640,60512,60352,60480,63151,63443,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,60934,60384,60714,65470,65535,65535,65535,65535,65535,65502,60747,60352,60512,63119,65460,63340,63308,63308,63308,63308,63308,63308,63340,63340,63340,63340,63340,63340,63340,63340,65493,65528,65528,65528,65495,65430,65363,63185,63019,62920,62854,60738,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60544,60416,62827,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {63224,58339,58272,60480,63021,63344,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63178,63180,65395,65429,65461,65526,65526,65526,65526,65526,65526,65526,65525,65459,63311,63243,63211,63211,63211,63211,63211,63211,63211,63211,63243,63211,60805,60512,60512,58272,60386,65331,65526,63311,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,63275,63243,60772,60544,60544,60642,61130,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,60579,58240,60480,60608,60608,60608,60608,60608,60608,60642,65331,63344,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63177,60672,60608,60384,58240,58272,58272,60352,60416,60480,60512,60576,60608,60640,60640,60640,60640,60640,60640,60640,60640,63184,63409,63307,63307,63307,63307,63307,63307,63307,63308,63308,63308,63308,63308,63340,60966,60640,60640,60640,60640,60640,60640,60640,60544,60384,60448,63086,65460,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,60934,60384,60681,65470,65535,65535,65535,65535,65535,65502,60648,60352,60512,63184,63410,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63339,63341,65494,65528,65528,65528,65528,65528,65528,65528,65528,65496,65462,65396,63217,63086,62985,62886,60740,60672,60640,60672,60672,60672,60672,60672,60672,60448,60416,63025,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65404,60453,58240,60480,62955,63345,63210,63211,63211,63211,63211,63210,63210,63210,63211,63211,63211,63211,63210,63210,63277,65525,65526,65526,65526,65526,65526,65526,65493,65459,63345,63277,63211,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,60838,60512,60512,60448,58208,60648,65494,65493,63276,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,61032,60577,60544,60544,60544,60903,63275,63243,63243,63243,63243,63243,63243,63243,63275,63275,63243,63275,63243,63275,60871,58240,60384,60608,60608,60608,60608,60608,60608,60642,65331,63376,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61033,60512,60448,60384,58272,58272,58240,58240,58272,58272,58240,58272,60352,60384,60448,60512,60544,60576,60608,60640,60642,65331,63376,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63307,63308,63307,60803,60640,60640,60640,60640,60640,60640,60640,60576,60384,60416,63020,65493,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60902,60384,60714,65502,65535,65535,65535,65535,65535,65469,60582,60352,60577,63250,63409,63307,63307,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,63342,63343,63377,65491,65493,65494,65527,65528,65528,65528,65528,65528,65528,65528,65528,65495,65398,65330,63152,62987,60705,60672,60672,60672,60608,60416,60482,65304,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65469,60487,58208,60448,60776,65394,63210,63178,63178,63178,63178,63178,63178,63178,63178,63178,63210,63210,63178,63178,63245,65459,65460,65459,65426,63345,63312,63278,63244,63211,63178,63178,63178,63178,63210,63210,63210,63211,63211,63211,63211,63211,61098,60773,60512,60512,60512,60352,58240,62990,65526,65426,63243,63211,63243,63211,63211,63211,63243,63243,63243,63243,63243,63243,63243,60805,60512,60576,60544,60512,60675,61130,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,61098,58369,58240,60480,60512,60512,60480,60480,60448,60545,63250,63376,63243,63243,63243,63243,63243,63275,63275,63275,63275,63275,63275,63275,61000,58272,58240,58272,58272,60353,60353,60386,60387,60452,60517,60518,60419,60353,58272,58272,58272,60352,60384,60448,60676,65397,63310,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,61162,60672,60640,60640,60640,60640,60640,60640,60640,60576,60384,60416,62922,65493,63340,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,60870,60352,60714,65502,65535,65535,65535,65535,65535,65403,60517,58272,60610,65364,63376,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63308,63307,63307,63307,63339,63340,63341,63375,63377,63411,65492,65494,65527,65528,65528,65528,65528,65528,65528,65529,65365,60738,60672,60672,60672,60576,60384,60581,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65469,60552,58176,60416,60710,65426,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,63211,63211,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63210,63210,63211,60968,60610,60512,60512,60480,58240,60387,65331,65526,63311,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61065,60577,60544,60576,60544,60544,60544,60968,63243,63211,63211,63211,63211,63211,63243,63243,63243,63243,63243,63243,63243,63243,60645,58240,58240,58240,58240,58240,58240,58240,60481,63217,63377,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,60968,58272,60419,62961,63060,63093,63125,63190,63191,65338,65436,65469,65305,63125,62961,60747,60551,60419,58240,58304,60808,65461,63276,63275,63275,63275,63275,63275,63275,63307,63307,63307,63307,63307,63308,61000,60640,60640,60640,60640,60640,60640,60640,60640,60576,60384,60384,62888,65493,63340,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,60870,60352,60681,65469,65535,65535,65535,65535,65535,63256,60419,58272,60643,65397,63343,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63308,63307,63307,63307,63307,63307,63340,63341,63342,63376,63410,65492,65493,65494,65527,65528,63185,60640,60640,60672,60672,60512,60384,60746,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65502,60650,58176,60416,60644,65426,63179,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63179,61066,60805,60545,60416,58176,60680,65494,65492,63244,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,60806,60512,60544,60576,60544,60544,60512,60708,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60936,58272,58273,60583,60682,60716,60518,58240,60481,63185,63376,63210,63243,63243,63243,63211,63243,63243,63243,63243,63243,63243,63243,60904,58272,60517,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65469,62928,58272,60384,62988,65459,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,63307,63307,60869,60640,60640,60640,60640,60640,60640,60640,60640,60608,60384,60384,60773,65461,63341,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,60870,60352,60681,65469,65535,65535,65535,65535,65535,63158,60386,58304,60676,65429,63310,63275,63275,63275,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63308,63308,63308,63307,63307,63307,63307,63340,63340,63341,63343,63409,60874,60384,60416,60448,60480,60416,60384,63058,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65503,60782,58176,60384,60611,65394,63211,63178,63178,63178,63178,63178,63178,63146,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,63344,63086,60385,58208,63054,65526,63377,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,61065,60577,60512,60544,60576,60544,60544,60512,60545,61000,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61130,60482,58273,62993,65502,65502,60781,58240,60416,63151,63376,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60839,58240,60518,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60748,58240,60416,63086,63378,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63210,60577,60480,60512,60576,60608,60640,60640,60640,60640,60640,60416,60352,60676,65397,63310,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63340,60870,60352,60681,65470,65535,65535,65535,65535,65535,63092,60353,58304,60741,65461,63309,63275,63275,63275,63275,63275,63275,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63308,63308,63308,63307,63307,63307,63307,60676,60320,60384,60384,60352,60352,60582,65338,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,63027,58144,58304,60547,63249,63212,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,63178,63178,63178,63146,63146,63146,63146,63178,63178,63178,63178,63178,63178,63178,63178,63212,65425,63249,58274,58307,65395,65526,63278,63178,63178,63210,63210,63178,63210,63210,63211,63211,63211,63210,63211,60838,60512,60512,60544,60544,60544,60544,60544,60512,60740,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60774,58208,60617,65470,65535,62862,58240,60416,63150,63377,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60806,58240,60584,65437,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,60552,58240,60513,63249,63344,63243,63243,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,61000,60352,58240,58272,58272,60352,60384,60416,60480,60512,60544,60384,60352,60643,65397,63343,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63340,60838,58272,60681,65470,65535,65535,65535,65535,65535,63027,58240,60384,62888,65461,63276,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63275,60579,60352,62795,62992,62926,62959,65304,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,63060,58177,58273,60514,63216,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60808,58144,60680,65493,65492,63212,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,61066,60578,60512,60512,60544,60384,60512,60544,60512,60512,60545,61001,63211,63211,63211,63178,63178,63178,63178,63178,63211,63210,63210,63178,63211,61001,58305,58307,65305,65535,60814,58208,60416,63117,63377,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60741,58240,60715,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65404,60453,58272,60611,65396,63310,63243,63243,63243,63243,63243,63243,63243,63275,63275,63275,63275,63275,60805,58240,60452,60683,60551,60484,60354,58273,58272,58272,58272,58272,58272,60578,65363,63344,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,60838,58272,60649,65469,65535,65535,65535,65535,65535,62961,58240,60384,62955,65492,63276,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,61130,60449,60386,63191,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,63093,58177,58241,60481,63118,63278,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63114,63114,63114,63146,63146,63146,63146,63178,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63114,60483,58176,63054,65526,63345,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60806,60448,60480,60512,60448,58176,60416,60544,60512,60512,60448,60741,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60580,58176,62895,65535,62863,58176,60352,63085,65425,63178,63210,63210,63210,63210,63210,63210,63210,63210,63210,63210,63211,60676,58208,60781,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63191,60354,58272,60741,65460,63244,63211,63211,63243,63243,63243,63243,63243,63243,63243,63243,63275,63242,60578,58240,60782,65535,65436,65338,63224,63125,62895,60747,60616,60419,58272,60546,63250,63376,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63308,60838,58272,60648,65469,65535,65535,65535,65535,65502,60749,58240,60384,63053,65460,63243,63243,63243,63243,63243,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,63307,63307,63307,63307,63307,63307,63308,61000,60384,60452,65371,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,63094,58210,58209,60416,63053,63279,63114,63114,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60839,60612,60611,60611,60579,60611,60611,60643,60644,60709,60806,60871,60968,61034,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60936,58241,60419,65395,65525,63245,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63146,60871,60838,62985,63117,63086,63022,63086,63182,63182,63182,63150,63150,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,60839,58208,60486,65404,60815,58208,60352,63084,65425,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60612,58176,60782,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63060,58241,60352,62922,65459,63243,63211,63211,63211,63211,63211,63211,63243,63243,63243,63243,63275,61033,58336,60353,63125,65535,65535,65535,65535,65535,65535,65535,65502,60715,58240,60480,63184,63377,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60838,58240,60649,65469,65535,65535,65535,65535,65469,60649,58240,60416,63086,65459,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,63275,63275,63243,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,63308,60838,58272,60551,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,63192,58275,58177,60416,63020,63311,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60709,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60449,60547,60742,61001,63146,63146,63146,63146,63146,63146,63146,63146,63146,60742,58144,60713,65525,65459,63179,63146,63178,63178,63146,63146,63146,63146,63178,63178,63146,63146,63178,63178,63179,65458,65526,65526,65526,65526,65526,65526,65526,65526,65526,63312,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,61033,58338,58209,63094,62929,58176,60352,63052,63377,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60547,58176,60783,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62896,58208,60384,63053,63378,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,63243,60838,58240,60486,65436,65535,65535,65535,65535,65535,65535,65535,65535,60814,58240,60416,63118,63378,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60838,58240,60649,65469,65535,65535,65535,65535,65469,60552,58240,60448,63183,63377,63211,63211,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,60967,60739,60772,60772,60804,60837,60870,60902,60935,60968,61000,61032,61065,61097,61129,63210,63210,63210,63243,63243,63275,63275,60676,58240,60748,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65371,58341,58177,60384,62891,63312,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60709,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60547,60968,63146,63114,63114,63114,63114,63114,63114,63114,58371,58177,63087,65525,63344,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63278,65525,65525,65525,65525,65525,65525,65525,65493,65493,65525,65459,63179,63146,63178,63178,63178,63146,63178,63178,63146,63146,63178,63178,63178,63178,60613,58176,60717,62994,58176,58272,63020,65426,63179,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63146,60515,58176,62929,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,60617,58208,60448,63183,63344,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,60611,58208,60782,65502,65535,65535,65535,65535,65535,65535,65535,65535,62896,58240,60384,63052,65426,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,60805,58240,60650,65502,65535,65535,65535,65535,65436,60453,58240,60513,63249,63344,63211,63211,63211,63211,63211,63211,63211,63243,63243,63243,63243,63243,60740,60512,60512,60512,60512,60544,60544,60512,60512,60544,60544,60544,60544,60576,60609,60641,60641,60674,60706,60739,60772,60772,60449,58272,62928,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65470,60423,58145,60384,60777,63345,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60708,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60612,63082,63114,63114,63114,63114,63114,63114,60904,58177,58307,65395,65525,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63245,63278,63278,63278,63245,63245,63245,63245,63245,63245,63245,63245,63179,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60904,58209,60421,60815,58209,58272,62987,65425,63178,63146,63146,63146,63146,63146,63146,63146,63146,63178,63178,63146,60483,58209,63027,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,60487,58208,60514,65330,63310,63178,63178,63211,63211,63211,63211,63211,63211,63211,63211,63243,61097,60417,58273,63092,65535,65535,65535,65535,65535,65535,65535,65535,65535,63060,58240,60352,62988,65427,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,60773,58240,60715,65502,65535,65535,65535,65535,65371,60420,58208,60546,65362,63343,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,63178,60610,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,58304,60353,63060,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65502,60488,58145,58304,60711,63345,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60676,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60547,61001,63114,63114,63114,63114,63114,63114,60678,58112,60680,65525,65459,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,61066,60451,58177,60585,58209,58240,62923,63378,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,61034,60418,58209,63028,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63224,58307,58208,60612,65395,63245,63178,63178,63178,63178,63178,63178,63211,63211,63211,63211,63243,60872,58240,60420,65370,65535,65535,65535,65535,65535,65535,65535,65535,65535,63158,58273,60352,62922,65428,63243,63243,63243,63243,63211,63211,63211,63211,63211,63211,63243,63243,60773,58240,60782,65535,65535,65535,65535,65535,63224,58307,58208,60579,65363,63310,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61000,60545,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,58272,60387,63257,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65502,60554,58113,58273,60613,65393,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60676,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,62922,63279,63114,63114,63114,63114,63114,63081,60451,58144,63054,65525,63312,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60710,58144,58210,58177,58208,62890,65426,63179,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,61001,58305,58210,63126,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63061,58242,58240,60743,65459,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,60645,58208,60585,65470,65535,65535,65535,65535,65535,65535,65535,65535,65535,63191,58306,58272,60808,65460,63244,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60741,58208,60782,65535,65535,65535,65535,65535,63093,58242,58240,60613,65396,63277,63178,63211,63211,63211,63211,63211,63243,63243,63243,63211,63243,60870,60512,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60480,58240,60518,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,60653,58113,58273,60515,65361,63146,63082,63082,63082,63114,63114,63114,63114,63114,63114,63114,63114,60676,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,62858,65459,65491,63147,63114,63114,63114,63114,60872,58177,58307,65394,65524,63213,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,63114,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60968,58241,58145,58145,58208,62858,65426,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,61001,58274,58243,63290,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62929,58177,58272,62955,65426,63146,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63146,60450,58176,62929,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63257,60419,58272,60709,65428,63244,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60741,58208,60782,65470,65436,65404,65404,65371,62929,58209,58240,60645,65362,63148,61033,61033,61033,61001,60969,60969,60968,60936,61001,63178,63211,60740,60512,60512,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60416,58240,60650,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,60751,58081,58241,60483,63281,63147,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60676,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60580,63053,65491,65524,65524,63180,63082,63114,63114,63114,60678,58080,60681,65525,65458,63147,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60516,58112,58145,58208,60809,65426,63146,63114,63114,63114,63114,63146,63146,63146,63146,63146,63146,60936,58241,58243,65371,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,60684,58145,60352,63086,63345,63146,63146,63178,63178,63178,63178,63178,63178,63178,63178,63211,60936,58272,58274,63191,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63257,60388,58240,60611,65395,63244,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,60709,58208,60421,60584,60519,60486,60486,60453,58339,58208,58208,58273,60452,60418,58337,60385,58305,58305,58273,58273,58240,58240,58273,60709,63178,60935,60807,60742,60644,60578,60544,60512,60512,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60384,58240,62896,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,62963,58081,58209,60450,63216,63180,63049,63050,63050,63082,63082,63082,63082,63082,63082,63082,63082,60644,60417,60417,60417,60417,60417,60417,60417,60385,60417,60482,60645,62988,65394,65524,65524,65524,63312,63114,63082,63082,63082,61001,58371,58112,63054,65525,63312,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60775,58145,58145,58208,60776,65426,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60904,58209,58243,65371,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,60455,58145,60417,63216,63278,63146,63146,63146,63146,63146,63146,63146,63178,63178,63178,63210,60741,58176,60486,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65404,60486,58208,60546,65395,63278,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,60709,58208,58241,58241,58273,58273,58242,58274,58274,58274,58274,58274,58242,58275,58275,58307,60387,60387,60387,60419,60483,60484,58241,58273,61001,63210,63344,65494,65428,65298,63150,62988,62857,60676,60611,60577,60512,60512,60512,60544,60544,60544,60544,60544,60544,60544,60544,58272,58273,63027,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,63094,58081,58177,60417,63119,63213,63049,63050,63050,63050,63050,63050,63050,63050,63050,63050,63082,60709,60514,60514,60514,60546,60579,60613,60744,62890,63053,63248,65459,65524,65524,65524,65524,63312,63082,63082,63082,63082,63082,60872,58177,58307,65362,65524,63181,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,63082,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60969,58274,58113,58176,60744,65426,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60872,58144,58308,65403,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65404,58340,58176,60548,65362,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60514,58176,60716,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,60552,58208,60482,65330,63311,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,61001,60905,63119,63153,63185,63185,63217,63218,63250,63250,63282,65331,65331,65363,65363,65396,65396,65427,65396,65396,65460,65395,60485,58208,60936,63211,65458,65526,65526,65526,65526,65526,65494,65429,65363,63184,63052,62890,60710,60610,60545,60544,60512,60512,60544,60544,60512,58272,58273,60749,63224,65436,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65470,61146,56564,56499,61049,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,63127,58146,58145,60385,63053,63246,63049,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,61001,63180,65426,65394,65426,65426,65459,65491,65524,65524,65524,65524,65524,65524,65458,63246,63082,63050,63050,63050,63050,63082,60645,58080,60648,65524,65458,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,63082,61033,61001,60969,60936,60936,60872,60840,60807,60774,60742,60677,60676,60612,60580,60807,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60549,58112,58144,60646,65394,63147,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60839,58144,58341,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63192,58243,58176,60646,65427,63180,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60969,58273,58209,63093,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60618,58208,60449,63217,63311,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63210,63245,65525,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65526,65428,60419,58176,60904,63211,63344,65459,65492,65525,65525,65526,65526,65526,65526,65526,65526,65526,65461,65427,63250,63118,62954,62856,60677,60609,60480,58208,58176,58209,60354,60453,60650,63158,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65470,58904,54256,49706,47528,47495,49738,56564,63357,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,63192,58179,58113,58305,62955,63279,63049,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63049,63214,65524,65524,65524,65524,65524,65524,65524,65524,65524,65491,65425,63246,63115,63049,63050,63050,63050,63050,63050,63017,58371,58081,63054,65524,63311,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,61001,60742,60677,60677,60645,60613,60580,60548,60515,60483,60450,60449,60418,60418,60418,60386,60385,60385,60385,60385,60385,60353,60515,60969,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60807,58145,58144,60614,65426,63147,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60807,58144,58374,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62930,58177,58240,60776,65426,63146,63114,63146,63146,63146,63146,63146,63146,63146,63146,63178,60774,58144,60454,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60684,58176,60417,63151,63344,63146,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63213,65492,65525,65492,65492,65492,65492,65492,65492,65460,65459,65459,65459,65459,65459,65459,65459,65426,65426,65426,63248,60354,58208,60904,63178,63178,63179,63212,63245,63279,63345,65426,65492,65493,65525,65526,65526,65526,65526,65526,65526,65526,65494,65428,65362,63120,62891,60648,60518,60386,58240,58240,60453,65338,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63292,56694,52046,49640,47528,51658,53773,53740,49576,47527,52078,61049,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,63258,58245,58081,58273,62922,63311,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63050,63049,63181,65425,65425,65425,65425,65425,65393,63312,63279,63213,63115,63082,63049,63049,63050,63050,63050,63050,63050,63082,60840,58145,58308,65394,65524,63181,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60807,60385,60353,60353,60353,60353,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60774,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,61001,58306,58112,60483,65425,63147,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60742,58112,60422,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60783,58145,58240,62988,65393,63114,63114,63114,63114,63114,63114,63146,63146,63146,63146,63146,60548,58144,60716,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60749,58176,60352,63053,63345,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63179,63212,63212,63179,63212,63212,63179,63179,63179,63179,63179,63179,63179,63179,63179,63179,63179,63179,63178,63179,61001,58305,58208,60904,63178,63146,63146,63146,63146,63146,63146,63179,63179,63212,63278,63344,65426,65459,65493,65525,65526,65526,65526,65526,65526,65526,65526,65526,65461,65363,63087,58306,58242,63159,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,61114,56498,49835,47528,49577,53740,55822,55855,55855,55855,55822,51658,47495,49705,56564,63357,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65437,60391,58081,58241,60777,63312,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63050,63082,63082,63082,63082,63049,63049,63049,63049,63049,63049,63050,63049,63049,63049,63049,63049,63050,63082,60613,58048,60616,65524,65426,63115,63050,63050,63050,63050,63050,63050,63050,63082,63082,63049,60548,60353,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60483,60969,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60581,58080,60387,65393,63179,63082,63114,63114,63114,63114,63114,63114,63114,63114,63114,60710,58112,60456,65437,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,60553,58145,58305,63151,63311,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,61001,58274,58177,63125,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62896,58176,58272,62955,65426,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60968,58241,58176,60904,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,63179,63212,63245,63311,63345,65458,65492,65493,65525,65526,65526,65526,65526,63185,58241,58307,63225,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63389,58871,54223,49737,49576,49577,53773,55822,55855,57935,57967,57967,57935,55887,55855,53772,49576,47527,52045,61049,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,58409,58049,58241,60679,63312,63050,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60969,58339,58112,63053,65524,63279,63049,63050,63050,63050,63050,63050,63050,63050,63050,63082,60840,60386,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60742,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60807,58113,58243,63281,63180,63082,63082,63082,63082,63082,63082,63082,63082,63082,63114,60678,58113,60521,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65404,58342,58145,60417,63248,63245,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60807,58177,58276,63258,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62994,58177,58240,62858,65394,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60936,58241,58144,60872,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,63211,63244,63278,63344,65426,65459,65493,62956,58144,60519,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,58871,52013,47560,49576,51658,55821,55855,57967,57967,57999,57999,57967,57999,57999,57999,57967,55855,55854,51658,47495,47657,56531,63357,65535,65535,65535,65535},
-    {65535,65535,65535,60522,58049,58209,60582,63312,63082,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60840,58145,58275,65394,65524,63180,63049,63050,63050,63050,63050,63050,63050,63050,63050,63049,60613,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60451,60937,63082,63050,63050,63050,63050,63050,63050,63050,63050,63050,63082,60969,58306,58113,63086,63181,63049,63050,63050,63050,63082,63082,63082,63082,63082,63082,60613,58081,60554,65470,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63257,58211,58144,60548,65362,63180,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60613,58144,60586,65470,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63158,58177,58208,60744,65426,63179,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60872,58241,58144,60839,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63179,63212,60613,58144,60650,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61082,49738,49576,53772,55854,57967,57999,58064,58031,58031,58031,57999,58031,58031,58031,58031,57999,57999,57967,55855,53773,49576,47527,52013,61049,65503,65535,65535},
-    {65535,65535,65535,60620,58049,58177,60451,63280,63082,63049,63049,63049,63049,63049,63049,63049,63049,63049,63017,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60614,58017,60648,65492,65458,63082,63049,63050,63050,63050,63050,63050,63050,63050,63082,60872,60418,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,60742,63082,63050,63050,63050,63050,63050,63050,63050,63050,63050,63082,63082,60549,58048,60778,63213,63049,63050,63050,63050,63050,63050,63050,63050,63082,63082,60549,58081,60555,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63028,58114,58145,60647,65394,63147,63082,63114,63114,63114,63114,63114,63114,63114,63114,61001,58371,58145,60816,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63224,58210,58176,60678,65395,63179,63114,63114,63114,63114,63114,63146,63114,63146,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,63146,63114,63146,63146,63114,63114,63114,63114,63114,63146,63114,63146,60839,58241,58176,60839,63146,63114,63114,63114,63114,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,61033,58338,58176,60815,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,58774,47560,53740,58000,58064,58064,60564,65113,60402,58063,58064,58064,58063,58031,58031,58031,58031,58031,58031,57999,55887,55854,51658,47495,49705,56629,65535,65535},
-    {65535,65535,65535,60719,58017,58145,60418,63248,63115,63017,63017,63049,63049,63017,63049,63017,63049,63049,63049,63017,63049,63017,63049,63049,63017,63049,63049,63017,63049,63017,63049,63049,63017,63049,63049,63049,60937,60808,60613,58178,58081,63021,65524,63279,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60645,58305,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,60451,60936,63082,63050,63050,63050,63082,63082,63082,63049,60969,60872,60742,60419,58048,60681,63214,63050,63082,63082,63082,63082,63082,63050,63049,60969,60904,58403,58081,60653,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60752,58081,58176,60776,65426,63114,63082,63082,63082,63114,63114,63114,63114,63114,63114,60872,58177,58210,63191,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63257,58243,58176,60579,65394,63180,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60807,58241,58144,60839,63146,63114,63114,63114,63114,63114,63114,63114,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60904,58241,58209,63093,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,58806,47560,51690,58031,58063,60402,65405,65437,60402,58096,58096,58096,58096,58096,58064,58064,58063,58063,58063,58031,58031,57967,55855,53740,47496,49803,63292,65535},
-    {65535,65535,65535,62898,58017,58145,58338,63216,63148,63017,63049,63017,63049,63017,63049,63049,63049,63017,63049,63049,63049,63017,63049,63017,63049,63017,63049,63049,63049,63049,63049,63049,63017,60936,60807,60645,60484,58306,58241,58049,58211,65361,65524,63180,63017,63049,63049,63049,63049,63049,63049,63049,63049,60904,60418,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58306,58305,60710,63082,63082,63049,60969,60904,60807,60710,60580,60483,60386,58305,58177,58048,60648,63084,60840,60807,60775,60742,60710,60677,60645,60548,60483,60418,58209,58081,60784,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60653,58081,58241,60614,63019,60904,60969,63049,63082,63082,63114,63114,63114,63114,63114,60677,58113,58341,65371,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65338,58276,58145,60482,65361,63213,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60774,58209,58112,60807,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60774,58176,58242,63224,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60952,49640,51690,58064,56015,60758,65535,60790,58128,58128,58128,58096,58096,58096,58096,58096,58096,58096,58096,58096,58064,58031,57967,55855,49577,47592,60985,65535},
-    {65535,65535,65535,63094,58018,58113,58306,63118,63180,63017,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63017,63017,60937,60904,60840,60743,60645,60516,58371,58306,58274,58274,58274,58177,58017,60584,65492,65458,63082,63017,63049,63049,63049,63049,63049,63049,63049,63049,60645,58305,58306,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58306,58305,60451,60710,60678,60581,60451,60418,58306,58273,58305,58305,58306,58306,58177,58049,58210,60418,58338,58338,58306,58305,58273,58273,58305,58305,58305,58306,58177,58049,60817,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65437,60456,58081,58273,58305,58305,60418,60450,60515,60612,60677,60774,60840,60936,61001,63049,60451,58112,60652,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65371,58374,58145,60418,63217,63246,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,61033,60969,60904,60807,60579,58208,58112,60807,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,63146,63146,63146,63146,60580,58144,60389,65338,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,58969,47625,51690,58064,58063,60467,62935,58289,58160,58160,58128,58128,58128,58096,58096,58096,58096,58096,58096,58096,58096,58096,57999,55855,49577,47592,58936,65535},
-    {65535,65535,65535,63160,58082,58081,58273,60451,60548,60548,60613,60645,60678,60742,60742,60742,60742,60742,60775,60742,60742,60742,60710,60678,60613,60581,60516,60451,58371,58306,58274,58242,58242,58274,58274,58274,58274,58274,58113,58049,62924,65491,63279,63017,63017,63017,63049,63049,63049,63049,63049,63050,60872,58371,58274,58306,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58305,58305,58273,58273,58241,58241,58241,58241,60385,60385,58306,58306,58306,58274,58274,58274,58274,58306,58306,58306,58306,58306,58306,58306,58145,58017,58177,58305,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58145,58049,62930,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65338,58245,58113,58305,58306,58306,58305,58305,58305,58305,58305,58305,58338,60418,60483,60515,58209,58113,62963,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,60521,58145,60385,63119,63279,63081,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,63081,61001,60969,60904,60839,60807,60742,60677,60580,60515,60482,60418,60385,60385,58177,58145,60548,60774,60807,60839,60904,60969,61001,61033,63082,63114,63114,63146,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,61033,60418,58145,60586,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,56986,47657,51690,58064,58096,58064,58160,58160,58160,58160,58160,58128,58128,58128,58128,58128,58096,58096,58096,58096,58096,58096,58031,55855,49577,47592,58936,65535},
-    {65535,65535,65535,63193,58115,58049,58274,58241,58242,58242,58242,58242,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58242,58242,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58081,58049,60420,60581,60516,60484,60516,60516,60516,60548,60581,60581,60581,60613,60484,58274,58306,58306,58305,58273,58273,58241,58241,58209,58209,58209,58177,58145,58145,58113,58113,58113,58081,58081,58081,58049,58049,58049,58049,58049,58241,60385,58306,58306,58306,58274,58274,58274,58306,58306,58306,58306,58306,58306,58306,58306,58145,58049,58177,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58113,58082,62996,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63192,58114,58113,58305,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58305,58273,58113,58245,65338,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,60619,58113,58305,63020,63344,63114,63114,63114,63114,63114,63114,63082,63082,61001,60969,60936,60904,60872,60807,60742,60710,60645,60580,60515,60483,60451,60418,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58145,58145,58273,60385,58305,60385,60418,60450,60483,60515,60547,60612,60677,60742,60807,60871,60936,60969,61001,61034,63114,63114,63146,63146,63146,63146,63146,60904,58273,58145,60717,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,59099,47657,51690,58064,58096,58096,58192,58160,58160,58160,58160,58160,58160,58128,58128,58128,58128,58128,58096,58096,58096,58096,58031,55855,49577,47592,58936,65535},
-    {65535,65535,65535,63258,58212,58017,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58081,58017,58177,58241,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58306,58306,58145,58017,58017,58017,58017,58017,58017,58017,58017,58049,58049,58082,58114,58147,58212,58278,58311,58344,60457,60522,60424,58049,58145,58305,58306,58306,58306,58274,58274,58274,58306,58306,58306,58306,58306,58306,58306,58306,58145,58049,58209,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58113,58114,63094,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62963,58081,58145,58305,58306,58306,58306,58306,58306,58306,58305,58306,58306,58306,58306,58209,58081,60621,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60653,58113,58240,60711,63117,60839,60807,60775,60742,60677,60613,60580,60547,60515,60451,60450,60386,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58145,58145,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60418,60450,60483,60547,60579,60612,60677,60742,60807,60872,60936,60709,58209,58145,62897,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63324,49738,49610,58031,58096,58096,58160,58160,58160,58160,58160,58160,58160,58160,58160,58128,58128,58128,58128,58096,58128,58096,58031,55855,49577,47592,58936,65535},
-    {65535,65535,65535,65371,58278,58017,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58081,58017,58209,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58306,58273,58049,58115,58376,60457,60554,60588,60621,60718,62898,62963,62996,63029,63062,63159,63258,65437,65470,65470,65470,65502,63258,58245,58049,58241,58306,58306,58306,58274,58274,58274,58306,58306,58306,58306,58306,58306,58306,58306,58113,58049,58209,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58273,58113,58180,63225,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60686,58049,58177,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58145,58114,62996,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60686,58081,58241,60385,60417,60385,60385,60385,60385,60353,60353,60353,60353,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58113,58145,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,58145,58210,63191,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63357,49770,49609,58031,58128,58096,58160,58160,58160,58160,58160,58160,58160,58160,58160,58128,58128,58128,58128,58096,58096,58096,58031,55855,49577,47592,58936,65535},
-    {65535,65535,65535,65436,58344,58017,58209,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58081,58049,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58306,58145,58017,60621,65469,65469,65502,65502,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60752,58017,58081,58306,58306,58306,58274,58274,58274,58306,58306,58306,58306,58306,58306,58306,58306,58113,58017,58209,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58273,58081,58213,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60555,58049,58209,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58306,58273,58113,58212,65371,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62865,58081,58209,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58113,58145,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60385,60385,60385,60385,60417,60385,60385,60385,60385,60417,60385,58145,58276,65338,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63357,49835,49577,55951,58128,58096,58160,58160,58160,58160,58160,58160,58160,58128,58128,58128,58128,58128,58096,58096,58096,58096,58031,55855,49577,47592,58936,65535},
-    {65535,65535,65535,65535,60523,55937,58177,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58241,58049,58049,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58049,58083,63127,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63290,58245,58017,58241,58306,58306,58274,58274,58274,58306,58306,58306,58306,58306,58306,58306,58306,58081,58017,58241,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58273,58049,58181,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65404,58343,58049,58241,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58241,58049,60424,65437,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62995,58113,58177,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58081,58145,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60385,60385,60385,60417,60417,60385,60385,60385,60417,58273,58145,60521,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65502,65535,65535,65535,63390,51948,49576,55919,58096,58064,58128,58160,58160,58160,58160,58160,58160,58128,58128,58128,58096,58096,58096,58096,58096,58096,58031,55855,49577,47592,58936,65535},
-    {65535,65535,65535,65535,60621,55937,58145,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58241,58049,58017,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58177,58017,60490,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60784,58017,58113,58305,58306,58274,58274,58274,58306,58306,58306,58306,58306,58306,58306,58305,58081,58017,58241,58306,58305,60385,60385,60385,60385,60385,60385,60385,58337,58273,58017,58246,65437,65535,65535,65535,65535,65535,65535,65535,65535,65535,63258,58213,58049,58274,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58337,58145,58049,60784,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63193,58146,58145,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58273,58081,58145,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60385,60385,60385,60417,60417,60385,60385,60385,60417,58177,58113,60784,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65403,63223,63157,63124,62960,62860,62860,62927,63058,63157,63125,49834,49576,55919,58064,58128,58096,58128,58160,58160,58160,58128,58128,58128,58096,58096,58096,58096,58096,58064,58064,58064,58031,55855,49577,47592,58936,65535},
-    {65535,65535,65535,65535,60686,55937,58113,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58209,58017,58049,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58081,58050,62996,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65339,58246,58017,58209,58274,58274,58274,58274,58306,58306,58306,58306,58305,60385,60385,60416,58272,60352,60448,60448,60448,60448,60448,60480,60448,60480,60448,60448,60448,60448,60384,60419,62959,63190,65370,65502,65535,65535,65535,65535,65535,65535,63192,58115,58081,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58113,58114,63094,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63258,58180,58113,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58273,58081,58177,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60417,60385,60385,60417,60417,60385,60385,60417,60385,58145,58146,63094,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65371,63223,62959,60713,60581,60482,60449,60416,60416,60416,60416,60416,60416,60416,60385,51813,47496,53805,58000,58096,58128,58096,58096,58096,58128,58128,58096,58096,58096,58064,58096,58064,58064,58063,58064,58063,57999,55855,49577,47592,58936,65535},
-    {65535,65535,65535,65535,60752,55937,58113,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58177,58081,58017,58017,58049,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58177,58017,58344,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60784,58017,58081,58274,58274,58274,58306,60385,60417,60416,60448,60448,60448,60480,60480,60480,60480,60480,60512,60546,60579,60611,60612,60612,60612,60612,60611,60546,60512,60480,60480,60480,60481,60580,62826,63058,65403,65535,65535,65535,65535,63160,58082,58049,58209,58241,58273,58306,58306,58306,58305,58305,58306,58306,58306,58241,58049,58278,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65371,58245,58081,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58273,58049,58145,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60385,60385,60417,60417,60385,60417,60417,60385,60385,60417,58305,58113,58245,65371,65535,65535,65535,65535,65535,65535,65535,65535,65437,63157,62860,60581,60449,60416,60416,60514,60580,60710,60810,62924,62990,63022,62957,62891,60712,60549,53990,47495,49576,53772,57967,58032,58096,58096,58031,58064,58096,58096,58064,58064,58064,58064,58063,58063,58063,58031,58031,57967,55855,49577,47592,58936,65535},
-    {65535,65535,65535,65535,62996,58018,58081,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58242,58177,58113,58081,58017,55937,55937,58051,55969,58049,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58049,58050,62963,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65371,58246,58049,58241,60417,60448,60448,60480,60480,60448,60480,60513,60579,60644,60776,62956,63054,63120,63186,63253,65366,65398,65431,65431,65431,65431,65398,65333,63219,63120,63022,60776,60612,60513,60448,60480,60613,62991,65402,65535,65535,65371,60424,58017,58017,58017,58049,58081,58113,58145,58209,58241,58273,58273,58305,58177,58049,60520,63058,63157,65337,65369,65370,65370,65370,65403,65403,65436,65437,65470,65535,65535,65535,65535,65535,65535,65535,65404,60391,58081,58273,60385,60385,60385,60385,60385,60416,60448,60448,60448,60448,60448,60416,60416,60416,60417,60417,60417,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58209,58049,58177,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60385,60385,60385,60417,60417,60385,60385,60417,60385,60417,60417,60385,60385,60417,58209,58081,60587,65502,65535,65535,65535,65535,65535,65535,65469,63091,60680,60449,60416,60481,60646,62957,63120,65333,65431,65496,65528,65529,65529,65529,65529,65529,65528,65463,54673,43786,47559,47495,51658,55854,57967,58031,58064,58031,58031,58031,58063,58063,58063,58063,58031,58031,57999,57967,55887,55855,55854,49576,47592,58936,65535},
-    {65535,65535,65535,65535,63192,58050,58017,58113,58145,58177,58209,58209,58242,58242,58242,58242,58242,58242,58242,58242,58242,58242,58209,58177,58177,58145,58113,58081,58081,58017,55937,55937,55937,58018,58149,58377,60785,60817,58018,58049,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58177,55937,58312,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,63157,60550,60384,60448,60448,60480,60545,60611,60776,62956,63086,63219,65398,65464,65497,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65497,65463,63251,62957,60644,60480,60448,60613,63091,65502,65535,65338,60817,60522,58344,58213,58115,58050,58017,58017,58017,58017,58049,58113,58049,58176,60481,60481,60481,60513,60514,60514,60547,60579,60612,60613,60679,60712,62794,62925,62958,62992,63057,63158,65337,65436,65469,60555,58049,58241,60385,60385,60385,60385,60416,60480,60480,60513,60480,60480,60448,60448,60448,60448,60448,60448,60448,60448,60448,60448,60448,60416,60417,60385,58305,58305,58273,58241,58209,58177,58145,58272,60352,58304,60384,60448,60448,60448,60448,60448,60448,60448,60416,60416,60416,60416,60416,60448,60448,60448,60416,60417,60385,60385,60417,60417,60385,60385,60417,58145,58081,60784,65535,65535,65535,65535,65535,65535,63223,60713,60449,60416,60580,62924,63251,65495,65529,65529,65529,65529,65529,65529,65529,65528,65528,65528,65528,65528,65528,54964,38062,41932,45640,47495,49576,53740,55855,57967,58031,58031,57967,58031,58031,58031,57999,57967,55887,55855,55855,55822,53741,51658,47495,47625,58937,65535},
-    {65535,65535,65535,65535,65437,60490,55970,55937,55937,55937,55937,55937,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,55937,55937,55937,55937,55937,55937,58018,58084,58214,60458,60719,62963,63258,65469,65535,63127,58018,58017,58114,58114,58114,58145,58145,58145,58145,58177,58177,58177,58177,58177,58017,58018,62931,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65337,62992,60678,60513,60480,60512,60611,62857,63022,63252,65430,65497,65529,65530,65530,65530,65530,65530,65530,65530,65529,65529,65528,65528,65527,65526,65526,65526,65526,65526,65526,65527,65527,65528,65529,65529,65530,65530,65431,63087,60645,60480,60513,62892,65436,65535,65535,65502,65469,65371,63127,62996,60818,60654,60457,58311,58181,58115,58114,60384,60512,60744,60744,60744,60679,60644,60578,60545,60513,60513,60513,60480,60480,60448,60448,60448,60448,60513,60547,60613,62859,60519,58049,58209,60385,60385,60385,60385,60448,60480,62957,63154,63121,63087,63021,62989,62956,62891,62858,60744,60645,60545,60513,60480,60480,60448,60448,60448,58240,58081,58049,58049,58049,58049,58240,60480,60480,60480,60480,60480,60481,60481,60481,60481,60481,60481,60481,60513,60513,60513,60545,60579,60579,60480,60416,60417,60385,60385,60417,60417,60417,60417,60385,58113,58114,63029,65535,65535,65535,65535,65469,62992,60515,60416,60547,62990,65430,65528,65529,65528,65528,65528,65528,65526,65525,63443,63442,63441,63408,63408,63408,63409,63409,63345,50702,40173,40013,43753,47559,47495,51658,55821,55855,57967,57999,57999,57967,57967,55855,55855,55822,53741,53707,49577,47495,47495,47560,45805,57018,65535},
-    {65535,65535,65535,65535,65535,65404,60850,60719,60589,60425,58311,58214,58181,58181,58149,58116,58116,58148,58116,58148,58181,58213,58246,58279,58377,60589,60719,60817,63028,63225,65404,65469,65535,65535,65535,65535,65535,65371,58312,55938,55937,55937,55937,55937,55937,55937,55937,55937,55937,55937,55937,55937,55937,60458,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65304,62860,60579,60448,60480,60611,62922,63186,65398,65497,65530,65530,65530,65530,65530,65530,65529,65529,65528,65526,63476,63475,63473,63440,63439,63438,63437,63437,63437,63437,63437,63437,63437,63437,63437,63438,63439,63473,63475,65526,65528,65529,65431,62957,60512,60480,62826,65436,65535,65535,65535,65535,65535,65535,65535,65535,65469,65404,65371,63160,60715,60448,60678,65431,65496,65464,65464,65431,65430,65398,65366,65332,63252,63186,63121,63023,62988,62922,60777,60711,60611,60512,60480,60416,58113,58145,60385,60353,58305,58305,60416,60480,63186,65530,65530,65530,65530,65530,65530,65529,65529,65464,65431,65398,65332,63186,63023,62890,60744,60513,60448,60357,60391,60359,58245,58180,60353,60481,62958,63186,63186,63219,63219,63219,65300,65332,65333,65333,65365,65398,65398,65398,65430,65430,65365,60580,60416,60417,60385,60417,60417,60417,60417,60417,58273,58081,58278,65371,65535,65535,65535,65436,62860,60449,60448,62858,65397,65528,65528,65528,65528,65527,65493,63442,63407,63373,63372,63372,63372,63372,63372,63372,63372,63372,63339,61292,61227,52810,42248,37993,39784,45607,47495,49576,53740,55854,55855,55855,55855,55855,55822,53741,51626,47496,47495,47527,47625,45836,46064,40147,57115,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65437,65404,65371,65371,65339,65339,65338,65338,65338,65338,65338,65339,65371,65371,65404,65437,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63258,60817,60719,60686,60654,60621,60621,60589,60524,60524,60524,60491,60490,60491,60719,63258,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,63025,60547,60448,60512,60743,63088,65398,65529,65530,65530,65530,65530,65530,65529,65527,65525,65523,63473,63439,63438,63437,63437,63436,63436,63436,63436,63436,63436,63436,63437,63437,63437,63437,63437,63436,63436,63436,63436,63436,63436,63437,63438,63473,65526,65497,63087,60513,60448,62860,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65468,60679,60480,63088,65530,65529,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65530,65529,65529,65497,65464,65398,65300,60776,60480,58208,58049,58081,58081,58049,58081,60384,60480,63186,65529,65528,65528,65529,65529,65529,65529,65529,65529,65529,65530,65530,65530,65530,65529,65399,60613,60514,63125,65404,65404,65371,65339,60713,60448,63153,65530,65530,65530,65530,65529,65529,65530,65529,65529,65529,65529,65529,65529,65529,65529,65496,60644,60416,58208,58145,58145,58177,58209,58241,58273,58177,58049,60555,65502,65535,65535,65468,62827,60416,60515,63088,65496,65528,65528,65528,65526,63410,63374,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63340,61259,61259,57066,46472,38054,37894,43719,45479,47495,51658,55821,55822,53773,51659,49576,47528,47527,47592,47787,43919,42098,40147,40179,48599,63422,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65370,60612,60480,60744,63186,65496,65530,65530,65530,65530,65530,65528,65525,63474,63439,63438,63437,63436,63436,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63437,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63440,65526,63087,60481,60449,63058,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63058,60448,60678,65464,65529,65526,65524,65524,65525,65525,65526,65526,65527,65527,65528,65528,65528,65529,65529,65529,65529,65530,65530,63186,60480,60385,58179,58115,58115,58180,58245,60417,60480,63186,65526,63439,63439,63439,63439,63440,63441,63442,65523,65492,65525,65526,65527,65528,65529,65398,60547,60482,63223,65535,65535,65535,65535,62827,60416,63054,65529,65527,65527,65526,65526,65526,65525,65525,65525,65525,65525,65525,65492,65492,65492,65458,60675,60416,58209,58049,58049,58049,58049,58049,58049,58049,58082,62963,65535,65535,65469,62860,60384,60516,63186,65528,65528,65528,65527,63409,63373,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,61260,61259,59179,52810,42247,37958,39815,45607,47495,49576,49576,47496,47495,47527,45510,41475,39717,40048,40211,42260,46518,54970,63390,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65337,60547,60546,65366,65530,65529,65530,65529,65528,65525,63441,63438,63437,63436,63436,63436,63437,63437,63437,63437,63437,63437,63437,63437,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63404,63404,63404,63404,63437,63442,62957,60416,60547,65304,65535,65535,65535,65535,65535,65535,65535,65535,65436,60646,60448,63088,65530,65528,63439,63404,63436,63436,63436,63437,63437,63438,63406,63438,63439,63439,63439,63440,63442,63443,65524,65526,65396,60579,60482,62994,63160,63192,63225,63191,60581,60481,63219,65526,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63437,63438,63438,63471,63245,60513,60514,63223,65535,65535,65535,65535,62860,60416,62956,65528,63407,63405,63405,63405,63405,63404,63404,63404,63404,63404,63404,63404,63404,63404,63371,60706,60416,60648,62996,60784,60653,60555,60490,58344,58343,60784,65437,65535,65535,62993,60417,60483,63186,65528,65528,65528,65492,63374,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,61292,61259,61259,57066,46472,38054,37894,43719,47559,47527,45607,43752,41964,37866,37539,37440,43813,52693,59228,63422,65503,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65370,60612,60513,63220,65530,65529,65527,63443,63439,63437,63436,63436,63437,63437,63437,63437,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63404,63436,63436,63436,63436,63404,63404,63404,63404,63404,63404,63404,63404,63436,63375,60678,60416,62827,65502,65535,65535,65535,65535,65535,65535,65535,63091,60449,60614,65431,65529,65525,63405,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63405,60773,60416,62992,65535,65535,65535,65436,60614,60449,63219,65525,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,61128,60480,60514,63223,65535,65535,65535,65535,62926,60416,62891,65528,63439,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63372,60738,60416,60712,65535,65535,65535,65535,65503,65469,65436,65535,65535,65535,63256,60516,60416,63055,65528,65528,65528,63410,63372,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,61259,61259,59179,52810,42247,37990,39879,39847,37926,35943,38058,42254,50511,54310,58240,60583,65370,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,60679,60480,63121,65529,63474,63437,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63404,63436,63436,63436,63436,63404,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63437,63179,60481,60514,63223,65535,65535,65535,65535,65535,65535,65469,60679,60416,63023,65529,65528,63440,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,61064,60448,60679,65436,65535,65535,65403,60614,60449,63252,65525,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,61096,60480,60514,63223,65535,65535,65535,65535,63125,60448,60745,65495,63408,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63372,60772,60416,60614,65436,65535,65535,65535,65535,65535,65535,65535,65535,65502,60746,60352,60778,65495,65528,65527,63377,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63308,61259,61227,61227,57066,46504,38055,38023,40135,44360,50697,57068,63379,65332,60615,60352,60648,65402,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62859,60448,62989,65528,63437,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60740,60416,62893,65502,65535,65535,65535,65535,65535,63124,60481,60580,65398,65529,65525,63437,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63307,60545,60482,63223,65535,65535,65403,60614,60449,65300,65525,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60999,60480,60514,63223,65535,65535,65535,65535,65337,60449,60580,65463,63441,63372,63404,63404,63404,63404,63372,63372,63372,63372,63372,63372,63404,63372,63372,60804,60448,60515,65304,65535,65535,65535,65535,65535,65535,65535,65535,63158,60450,60482,65331,65528,65527,63410,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63308,63340,63308,63340,63308,63308,63308,63340,61259,61259,61259,59179,54922,50729,54954,59147,61259,61259,61260,63377,65364,60614,60352,60746,65469,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62893,60416,62891,65528,63438,63404,63404,63404,63436,63436,63436,63436,63436,63436,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61064,60448,60581,65403,65535,65535,65535,65535,65469,60712,60416,62990,65529,65528,63440,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60772,60416,62959,65535,65535,65403,60614,60449,65333,65492,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60934,60480,60514,63223,65535,65535,65535,65535,65370,60515,60514,65398,63442,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,60836,60448,60449,63158,65535,65535,65535,65535,65535,65535,65535,65502,60747,60352,62892,65528,65528,65459,63340,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63307,61259,61259,61259,61259,61259,61259,61259,61259,61259,63307,63376,63217,60450,60451,65337,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62959,60416,60744,65496,63440,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61259,60545,60449,63157,65535,65535,65535,65535,63157,60482,60547,65365,65529,65493,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61032,60448,60680,65469,65535,65403,60581,60449,65333,65492,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,60803,60448,60514,63223,65535,65535,65535,65535,65370,60548,60482,65333,63443,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,60901,60480,60384,63124,65535,65535,65535,65535,65535,65535,65535,65370,60516,60418,63251,65528,65494,63341,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,63308,63308,63308,63308,63307,63308,63308,63308,63308,63307,63307,63307,63308,63307,63307,63307,63307,63307,61259,63307,63307,63307,63307,63308,63274,60870,60384,60450,65304,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63059,60448,60612,65463,63474,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63372,63339,61226,61160,61096,61063,61063,61063,61064,61129,63307,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63372,63404,63404,63372,60708,60416,62992,65535,65535,65535,65470,60746,60416,62891,65528,65528,63408,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61227,60513,60482,65337,65535,65403,60581,60449,65332,65492,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63340,60770,60448,60514,63223,65535,65535,65535,65535,65403,60581,60449,63219,65493,63372,63372,63372,63372,63372,63372,63340,63340,63340,63340,63340,63340,63340,63340,60901,60512,60384,62959,65535,65535,65535,65535,65535,65535,65535,63059,60353,60647,65495,65527,63377,63307,63308,63308,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63275,63210,61162,61162,61162,63210,63243,63307,63308,63308,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63210,60771,60576,60384,60418,63256,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65403,65305,63190,63025,62959,62959,62959,62992,63157,63256,65370,65470,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63223,60481,60513,65366,65523,63436,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63372,63209,61032,60900,60802,60770,60705,60672,60672,60672,60672,60672,60672,60672,60737,60868,63242,63404,63404,63404,63404,63404,63404,63404,63372,63372,63372,63372,63372,63372,63372,60773,60416,62893,65535,65535,65535,63223,60482,60514,65332,65529,65525,63372,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63372,60740,60416,62993,65535,65403,60548,60449,65332,65491,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63307,60770,60448,60482,63190,65535,65535,65535,65535,65469,60648,60384,63088,65526,63373,63372,63372,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60933,60544,60384,62828,65502,65535,65535,65535,65535,65535,65535,62861,60352,62924,65527,65493,63309,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63242,60934,60706,60641,60641,60641,60641,60673,60674,60738,60836,60967,61129,63275,63308,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,61064,60706,60576,60576,60384,60354,63224,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65370,63091,62827,60646,60612,60644,60645,60677,60709,60709,60677,60612,60612,60612,60713,62959,65304,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65370,60514,60481,63252,65525,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61162,60673,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60640,60770,63274,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,60837,60384,62762,65502,65535,65502,62860,60416,62859,65528,65528,63440,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63404,60967,60416,60680,65469,65370,60515,60449,65332,65491,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63274,60737,60448,60482,63223,65535,65535,65535,65535,65535,62828,60384,62990,65527,63373,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60933,60544,60384,62795,65502,65535,65535,65535,65535,65535,65469,60648,60352,63153,65527,63378,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,61065,60706,60576,60576,60576,60576,60576,60576,60576,60576,60544,60544,60576,60609,60739,60934,63210,63307,63307,63275,63307,63307,63275,63275,63275,63275,63275,63307,63275,60967,60609,60544,60576,60576,60384,60353,63192,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,63223,62860,60612,60644,62923,63055,63155,65172,63061,65045,65013,64980,65077,63093,65204,63057,62957,60710,60579,62826,63190,65502,65535,65535,65535,65535,65535,65535,65403,63025,63025,63190,65403,65436,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65370,60580,60448,63153,65526,63405,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,61194,60705,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,61031,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,60805,60384,60582,65436,65535,65337,60515,60450,63219,65529,65526,63373,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,61194,60513,60482,65337,65402,60483,60449,65333,65491,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,61129,60672,60416,60483,65305,65535,65535,65535,65535,65535,62926,60352,62891,65527,63374,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60934,60544,60352,60746,65502,65535,65535,65535,65535,65535,65404,60517,60385,65331,65526,63342,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,63210,60674,60544,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60674,60902,63210,63275,63275,63275,63275,63275,63275,63275,63275,63210,60804,60576,60576,60576,60576,60576,60384,60321,63191,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65337,62860,60579,60744,63120,65269,65077,64882,64624,64494,64494,64494,62576,62706,62835,62901,64981,62998,63094,63222,63154,62857,60579,62893,65436,65535,65535,65535,65535,65502,62958,60578,60644,60579,60613,60679,62860,63025,63157,65403,65469,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,60614,60416,63020,65527,63405,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63372,63372,63404,63275,60737,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,63116,63408,63372,63372,63372,63372,63372,63372,63340,63340,63340,63340,63340,63340,60804,60384,60516,65370,65535,62926,60384,60745,65495,65528,63441,63340,63340,63372,63372,63340,63372,63372,63372,63340,63372,63340,63372,63372,63372,63372,63340,63372,63372,63372,63372,63372,63372,63372,63372,63372,63340,60676,60384,63026,65370,60483,60449,65365,65491,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,61064,60608,60384,60549,65436,65535,65535,65535,65535,65535,63025,60384,60746,65527,63374,63339,63340,63340,63340,63340,63340,63340,63340,63340,63308,63308,63308,63340,60934,60544,60352,60713,65502,65535,65535,65535,65535,65535,65371,60419,60450,65396,65493,63276,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61032,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60544,60544,60707,61064,63275,63275,63275,63275,63275,63275,61032,60674,60544,60576,60576,60576,60576,60576,60384,58273,63191,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,63092,60613,60678,63154,65238,64914,64558,64331,64104,62056,62250,62608,62932,63095,63225,63290,63323,65339,63258,63161,63095,63127,65367,63153,60645,60745,65403,65535,65535,65535,65469,60679,62957,65432,65366,63186,63021,62858,60710,60611,60612,60679,62860,63058,63190,65436,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,62794,60384,62890,65527,63406,63372,63404,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63307,60770,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60739,65365,65527,63374,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63275,60706,60384,60482,65370,65370,60548,60417,63185,65528,65526,63373,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,60903,60352,60713,65337,60483,60449,65397,65490,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,61031,60576,60384,60647,65502,65535,65535,65535,65535,65535,63092,60385,60680,65463,63344,63339,63340,63340,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,60966,60544,60352,60713,65502,65535,65535,65535,65535,65535,65371,60387,60516,65429,65459,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61130,60641,60544,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60544,60512,60577,60935,63243,63275,63275,63210,60869,60577,60544,60544,60576,60576,60576,60576,60576,60384,58272,63158,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,62959,60546,62957,65302,64914,64493,64233,64006,61893,62315,62835,63193,65371,65469,65469,65501,65501,65501,65501,65469,65469,65404,63226,63128,65272,65333,60711,60712,65435,65535,65535,65436,60613,63121,65527,65527,65529,65530,65530,65464,65366,63219,62989,62825,60678,60579,60613,62793,63025,63157,65337,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62926,60416,60744,65495,63407,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63339,60802,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,63086,65528,65528,63376,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,61096,60640,60416,60417,63190,62993,60384,60646,65463,65528,63410,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63372,61130,60449,60516,63124,60515,60449,65397,65490,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60934,60544,60384,60713,65502,65535,65535,65535,65535,65535,63191,60385,60581,65430,63409,63307,63308,63308,63308,63308,63308,63308,63308,63308,63307,63307,63307,63308,60934,60512,60352,60680,65502,65535,65535,65535,65535,65535,63224,60354,60517,65429,65458,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,60935,60609,60544,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60544,60544,60544,60544,60902,63242,60968,60675,60544,60544,60544,60544,60576,60576,60576,60576,60576,60384,58240,63060,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65469,62860,60546,63120,65205,64558,64234,64039,61796,62218,62868,63258,65469,65501,65501,65501,65469,65436,65436,65436,65436,65469,65501,65501,65469,65403,63160,63190,63284,60678,62827,65469,65535,63223,60546,63218,63471,63437,63438,63440,63474,65525,65527,65529,65530,65530,65464,65333,63153,62924,60743,60612,60580,60679,62860,63059,63223,65436,65535,65535,65535,65535,65535,65535,65535,65535,62992,60416,60613,65430,63441,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63372,63340,63340,60835,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60705,63053,65495,65528,65527,63375,63340,63340,63340,63340,63340,63340,63340,63340,63340,63339,60836,60608,60448,60385,62927,60615,60384,63088,65528,65527,63374,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63339,60643,60385,62926,60483,60450,65397,65490,63307,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60869,60512,60352,62860,65502,65535,65535,65535,65535,65535,65370,60450,60482,65396,65490,63307,63308,63308,63308,63307,63307,63307,63307,63307,63307,63307,63307,63308,60967,60544,60352,60648,65501,65535,65535,65535,65535,65535,63225,60354,60451,65396,63377,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63215,62856,60609,60544,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60576,60544,60544,60544,60544,60544,60674,60544,60512,60544,60544,60544,60544,60576,60576,60576,60576,60576,60416,58240,62994,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65469,62861,60547,63153,65012,64363,64168,64006,61893,62542,63193,65436,65469,65469,65404,63193,62965,62705,62575,62543,62543,62737,62933,63160,63323,65469,65501,65436,63161,63187,63216,60547,63091,65535,63091,60577,65363,63470,63436,63436,63436,63436,63436,63437,63438,63440,63475,65525,65527,65529,65530,65497,65398,63186,63022,62824,60645,60579,60646,62794,62926,63190,65502,65535,65535,65535,65535,63058,60417,60513,65397,65491,63372,63372,63372,63372,63372,63372,63372,63372,63340,63340,63340,63340,63340,63340,60868,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,62854,63217,65496,65528,65528,65493,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,61097,60640,60640,60480,60384,60549,60385,60581,65430,65528,63410,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,61096,61032,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60903,60384,60582,60386,60450,65397,63409,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63307,60803,60480,60352,63026,65535,65535,65535,65535,65535,65535,65403,60516,60385,65299,65491,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,60967,60512,60352,60584,65469,65535,65535,65535,65535,65535,65371,60387,58305,63249,63344,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63345,65462,63217,62920,60675,60576,60544,60544,60576,60576,60576,60576,60576,60576,60576,60576,60544,60544,60544,60544,60544,60512,60544,60544,60544,60544,60544,60544,60544,60576,60576,60576,60608,60416,58240,62928,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,63058,60514,63121,62899,64591,62673,64039,61990,62738,63291,65469,65469,63323,62998,62543,62153,62023,61926,61861,61861,61828,61893,61925,62120,62575,63030,63323,65469,65404,63159,63281,60873,60647,65469,63025,60612,65396,63438,63436,63436,63437,63437,63437,63437,63436,63436,63436,63436,63437,63439,63473,65524,65526,65528,65529,65529,65432,65300,63088,62924,60677,60613,65436,65535,65535,65535,65535,63158,60417,60449,63251,65492,63372,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60901,60672,60672,60672,60672,60672,60672,60672,60672,60739,62919,63184,65462,65528,65528,65528,65494,63343,63339,63340,63340,63340,63340,63308,63308,63308,63308,63307,60803,60576,60640,60480,60352,60384,60352,62990,65528,65527,63342,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63307,60803,60771,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,61097,60417,60385,60353,60450,65397,63409,63307,63308,63308,63308,63308,63308,63308,63307,63307,63308,63308,63308,63275,60737,60448,60352,63124,65535,65535,65535,65535,65535,65535,65436,60582,60385,63186,65492,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63275,63308,60967,60512,58272,60551,65469,65535,65535,65535,65535,65535,65371,60387,58272,62955,63345,63242,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,63345,65526,65526,65395,63150,62889,60708,60610,60544,60544,60544,60544,60576,60576,60576,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60576,60576,60576,60544,58304,58240,63027,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,63223,60580,63022,65011,64624,65405,65340,62121,62737,65403,65469,65404,63063,62478,62023,61958,64136,64233,64266,64265,64233,64201,64168,64071,63973,61796,61991,62640,63192,65436,65371,63158,63180,60546,63091,62860,60679,63412,63437,63436,63436,63436,63436,63436,63436,63436,63437,63437,63437,63436,63436,63436,63436,63437,63438,63472,63442,65525,65527,65529,65530,63121,60612,65436,65535,65535,65535,65535,65370,60483,60384,63121,65526,63372,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,60966,60640,60672,60672,60706,60739,62853,63019,63151,65397,65495,65528,65528,65528,65528,65493,63342,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,60934,60608,60608,60640,60512,60352,60352,60483,65397,65528,65459,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63340,61032,60608,60640,63179,63340,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63275,60579,60352,60352,60450,65397,63377,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63210,60705,60416,60385,63157,65535,65535,65535,65535,65535,65535,65502,60714,60352,63088,65493,63308,63307,63307,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60967,60512,58272,60551,65469,65535,65535,65535,65535,65535,65371,60388,58272,60612,63214,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63278,65458,65526,65526,65526,65460,63282,63150,63020,62889,60741,60642,60577,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60576,60576,60480,58272,58240,60551,65371,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65436,60713,60777,65205,64363,65112,65535,62901,62608,63291,65469,65403,62868,62120,64039,64233,64298,64331,64298,64233,64169,64136,64136,64168,64136,64136,64039,63876,61763,62380,63128,65436,63225,63216,60739,60714,60647,62825,65491,63436,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63437,63437,63436,63436,63436,63437,63437,63439,63474,60872,60646,65436,65535,65535,65535,65535,65435,60549,60384,62989,65526,63341,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63340,63177,63014,63116,63185,65331,65397,65462,65527,65528,65528,65527,65528,65527,65494,63410,63341,63307,63308,63308,63307,63307,63308,63307,63307,63307,63308,61064,60641,60576,60608,60640,60544,60352,60320,62858,65527,65527,63343,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63275,60771,60608,60576,62986,63341,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63340,60806,60352,60352,60450,65397,63377,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,61130,60641,60384,60450,63223,65535,65535,65535,65535,65535,65535,65535,62863,58240,62892,65526,63309,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60999,60512,58272,60518,65469,65535,65535,65535,65535,65535,65403,60420,58272,60480,60774,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63210,63243,63278,63345,65492,65526,65526,65526,65526,65494,65493,65395,63217,63020,60808,60610,60545,60512,60544,60544,60544,60544,60544,60544,60544,60544,60576,60576,60448,58240,58241,60650,65338,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,63058,60547,63187,64557,64169,65242,65307,62608,63160,65469,65436,62868,62056,64168,64331,64363,64266,64168,62023,62088,62153,62120,62120,61926,63941,64039,64039,63974,63909,61731,62413,63225,65371,63157,60968,60515,60548,62922,65490,63404,63404,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63436,63404,60707,60713,65469,65535,65535,65535,65535,65436,60615,60352,62857,65527,63342,63339,63340,63340,63340,63340,63340,63340,63340,63340,63340,63308,63308,63308,63339,63340,65493,65528,65528,65528,65527,65527,65527,65527,65526,65460,63377,63341,63307,63307,63308,63308,63307,63307,63307,63307,63307,63307,63308,61097,60673,60576,60608,60608,60640,60544,60352,60418,63250,65527,65492,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,60999,60608,60608,60576,60741,63246,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,61033,60384,60320,60451,65397,63377,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,61064,60576,60352,60484,65337,65535,65535,65535,65535,65535,65535,65535,62928,58240,60745,65526,63309,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60999,60512,58272,60486,65469,65535,65535,65535,65535,65535,65403,60420,58240,60480,60512,60837,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63210,63210,63210,63212,63278,63345,65459,65493,65525,65526,65526,65526,65526,65494,65395,63152,62922,60644,60545,60512,60544,60544,60544,60544,60544,60544,60384,58208,58241,60749,65436,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65469,60680,62891,64978,64168,64071,64332,62154,62835,65436,65468,63095,62121,64168,64363,64331,64168,62088,62380,62738,62998,63128,63128,63063,62835,62348,61893,63909,63974,63974,63844,61796,62737,63291,63159,61035,60481,60449,62988,63441,63404,63404,63404,63404,63404,63404,63404,63404,63436,63436,63437,63436,63436,63436,63404,63404,63404,63436,63436,63436,63436,63437,63306,60577,62926,65535,65535,65535,65535,65535,65502,60746,60352,60679,65495,63375,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63308,63411,65527,65527,65526,65493,65460,63410,63344,63342,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63210,60674,60576,60608,60608,60608,60640,60544,58272,60549,65462,65527,63344,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63242,60739,60576,60608,60608,60608,63116,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63243,60515,58240,60483,65429,63344,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63308,60967,60544,60320,60551,65470,65535,65535,65535,65535,65535,65535,65535,63026,58240,60648,65494,63310,63275,63275,63275,63275,63275,63275,63275,63243,63275,63243,63243,63275,61000,60544,58272,60486,65469,65535,65535,65535,65535,65535,65403,60453,58240,60480,60512,60513,60806,63178,63211,63178,63210,63210,63210,63178,63178,63211,63211,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,63212,63277,63311,63344,65426,65459,65525,65526,65526,65526,65396,63151,60776,60578,60512,60544,60544,60480,58304,58208,58307,62961,65469,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,63223,60515,63154,64427,64071,64006,63844,62153,63225,65469,65403,62542,64006,64331,64331,64168,62380,62998,63290,65436,65469,65469,65469,65469,65436,63226,62705,61925,63909,63974,63909,61699,62120,63128,63193,61038,60514,60416,63121,63440,63372,63404,63404,63404,63404,63404,63404,63307,61031,61064,61129,61194,63307,63372,63404,63404,63436,63436,63437,63437,63436,63437,61096,60512,63058,65535,65535,65535,65535,65535,65535,62895,60352,60581,65430,63376,63307,63308,63308,63308,63308,63308,63308,63308,63308,63308,63307,63307,63307,63308,63307,63342,63343,63342,63341,63308,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63243,60967,60674,60576,60608,60608,60640,60512,58240,60615,65494,65493,63309,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63308,60967,60576,60608,60608,60608,60576,60839,63309,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,60741,58240,60484,65429,63344,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60934,60512,58272,60616,65502,65535,65535,65535,65535,65535,65535,65535,63027,58273,60582,65462,63311,63243,63275,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,61000,60512,58272,60453,65404,65535,65535,65535,65535,65535,65404,60421,58208,60480,60512,60481,60481,60741,61066,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,63245,63311,65393,65459,65525,65526,65493,63249,62889,60578,60416,58240,58176,60454,63158,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,62927,60647,65171,62023,64039,64006,61861,62608,65404,65469,63160,62121,64233,64363,64168,62315,63160,65468,65469,65468,65468,65468,65468,65469,65469,65469,63291,62640,61796,63909,63909,63844,61796,62835,63193,63119,60611,60417,63218,63406,63372,63372,63404,63372,63404,63404,63404,61128,60640,60672,60672,60705,60737,60802,60835,60901,60999,61096,61161,63274,63339,63372,60901,60481,63124,65535,65535,65535,65535,65535,65535,63025,60384,60482,65364,63410,63307,63308,63307,63308,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63275,63275,63275,63275,63275,63275,63275,63275,63178,62886,60608,60576,60608,60480,58240,60744,65527,63345,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63210,60674,60576,60608,60608,60608,60576,60643,63213,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60968,58240,60516,65429,63344,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60869,60480,58272,60682,65535,65535,65535,65535,65535,65535,65535,65535,63159,58306,60484,65397,63345,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63211,63243,61000,60544,58272,60421,65371,65535,65535,65535,65535,65535,65404,60421,58208,60480,60512,60481,60481,60448,60578,60903,63178,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63179,63245,63345,65459,65526,65525,63184,60582,58176,58176,60717,65502,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65469,60648,62925,62897,61925,64006,63974,61861,62933,65468,65469,62966,61958,64298,64331,62055,62868,65436,65469,65469,65469,65436,65404,65436,65469,65469,65469,65469,63160,62218,61731,63877,63876,61634,62478,63161,63151,60643,60449,65330,63405,63372,63372,63372,63372,63372,63372,63404,61031,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60704,60770,60803,60672,60547,63256,65535,65535,65535,65535,65535,65535,63190,60450,60384,63218,65491,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63343,65461,63020,60608,60608,60416,58240,62958,65526,63309,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,60902,60544,60576,60608,60608,60608,60576,60544,63019,63276,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61001,58240,60517,65429,63343,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,60804,60448,58272,60781,65535,65535,65535,65535,65535,65535,65535,65535,65403,60387,60386,65363,65426,63211,63243,63243,63211,63211,63211,63211,63211,63211,63211,63211,63243,61000,60544,60320,60420,65338,65535,65535,65535,65535,65535,65436,60486,58208,60448,60512,60481,60481,60481,60448,60481,60676,60936,63146,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63179,63278,65426,65525,65428,60779,58208,58242,62929,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65370,60516,63056,62704,61893,64006,63974,61893,63063,65469,65436,62900,61925,64298,64298,62055,63030,65469,65469,65436,63095,62705,62478,62705,63127,65404,65469,65469,65404,62705,61731,63844,63876,61699,62251,63128,63151,60611,60514,63346,63373,63340,63340,63340,63340,63372,63372,63372,60868,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60544,60647,65469,65535,65535,65535,65535,65535,65535,65436,60484,60352,63088,65492,63308,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63343,65428,62987,60576,58272,58273,63218,63410,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61130,60641,60544,60576,60608,60608,60608,60576,60544,60741,63277,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,61001,58240,60517,65429,63343,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63210,60739,60416,58240,62928,65535,65535,65535,65535,65535,65535,65535,65535,65436,60486,58240,63217,65458,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61032,60544,58240,60388,65338,65535,65535,65535,65535,65535,65469,60585,58176,60416,60512,60480,60481,60481,60481,60481,60448,60481,60644,60904,61066,63178,63178,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,63245,65425,65493,62923,58176,58243,63094,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,63256,60516,63187,60591,61861,63974,63973,61893,63095,65469,65469,62965,61926,64298,64331,62055,62932,65469,65404,62867,62023,61926,64039,61860,60137,63030,65436,65469,65469,62998,61925,63812,63876,61731,62121,63063,63118,60578,60614,63378,63340,63340,63340,63340,63340,63340,63340,63307,60770,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60480,62926,65535,65535,65535,65535,65535,65535,65535,65469,60582,58272,62989,65494,63309,63307,63307,63307,63307,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,63243,63243,63276,63313,60711,58208,60484,65396,63310,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,60870,60544,60576,60576,60608,60544,60544,60576,60576,60577,63116,63275,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63275,61001,58240,60549,65429,63343,63211,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63178,60641,60384,58240,63125,65535,65535,65535,65535,65535,65535,65535,65535,65469,60584,58240,63120,65459,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,61001,60545,58240,58307,63225,65535,65535,65535,65535,65535,65535,60750,58176,60384,60512,60480,60481,60481,60481,60481,60449,60449,60449,60449,60546,60741,60936,61066,63146,63178,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63278,65426,60746,58144,60487,65404,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,63191,60516,63220,60591,61764,63974,63974,61861,62965,65469,65469,63193,62185,64168,64363,64168,62478,63030,62640,60137,62120,62056,64136,64136,61796,62348,63258,65469,65469,63160,62023,61731,63844,61731,62218,63062,63116,60481,60713,63378,63339,63340,63340,63340,63340,63340,63340,63275,60902,60805,60705,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60672,60640,60449,63124,65535,65535,65535,65535,65535,65535,65535,65469,60648,58272,60777,65526,63310,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63244,63084,58305,58273,63085,63276,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,61097,60609,60544,60544,60576,60608,60416,60384,60576,60576,60512,62921,63276,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,60968,58240,60582,65429,63311,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61065,60577,58304,58273,63191,65535,65535,65535,65535,65535,65535,65535,65535,65502,60716,58240,63022,65492,63244,63211,63211,63211,63211,63211,63211,63211,63211,63211,63210,63211,61033,60545,58240,58307,63224,65535,65535,65535,65535,65535,65535,62996,58177,58240,60512,60481,60481,60481,60481,60481,60481,60449,60449,60449,60417,60417,60449,60547,60741,60871,61001,63146,63146,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63180,63248,60452,58177,63060,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,62994,60516,63253,62802,61926,63941,63974,61861,62737,65436,65501,65404,62673,61926,64234,64266,62088,61990,60105,62965,63193,62575,61893,64103,63941,61958,63063,65469,65469,63193,60008,61699,63876,61699,62414,63092,61033,60384,62858,63409,63307,63308,63308,63308,63308,63308,63340,63339,63376,65462,65364,63217,63084,62953,62854,60705,60672,60672,60672,60672,60672,60672,60576,60515,65305,65535,65535,65535,65535,65535,65535,65535,65502,60715,58240,60646,65494,63343,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63242,63210,63210,63178,63178,63178,63210,63210,63243,63243,63275,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63211,63243,63243,60645,58208,60645,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60903,60642,60641,60641,60609,60544,58241,58272,60544,60576,60512,60643,63181,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60968,58240,60582,65429,63310,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61033,60545,58272,60387,63256,65535,65535,65535,65535,65535,65535,65535,65535,65535,62928,58208,60811,65493,63244,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,61033,60545,58240,58274,63191,65535,65535,65535,65535,65535,65535,65403,60389,58177,60448,60512,60481,60481,60481,60481,60481,60449,60449,60449,60449,60449,60417,60417,60417,60449,60482,60612,60741,60839,60936,61033,63114,63146,63146,63146,63146,63114,63114,63114,63114,63146,63146,63146,63114,63114,63146,63114,63146,63114,63146,63114,63114,63179,60711,58144,60750,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,62896,60484,65300,62997,62250,63844,64006,63876,62380,63290,65501,65469,63258,62543,62023,64039,61991,62218,63030,65469,65469,62933,61990,64006,63974,61925,62933,65469,65501,63193,62023,61699,63844,61861,64722,63120,60870,60352,62924,63376,63307,63307,63307,63307,63307,63307,63308,63307,63343,65460,65494,65527,65528,65496,65463,65396,63218,63087,62920,60672,60672,60672,60544,60680,65502,65535,65535,65535,65535,65535,65535,65535,65535,62960,58240,60516,65397,63344,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63178,60870,60805,60739,60674,60641,60609,60609,60609,60609,60609,60642,60707,60805,60935,61065,63243,63243,63243,63243,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60904,58272,60417,61066,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63178,61098,63212,65394,65362,65329,63185,63120,63152,63151,63054,63021,63248,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60968,58208,60583,65461,63310,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60968,60512,58240,60452,65370,65535,65535,65535,65535,65535,65535,65535,65535,65535,62962,58176,60679,65525,63277,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63179,61033,60545,58240,58274,63126,65535,65535,65535,65535,65535,65535,65502,60750,58145,58241,60480,60481,60481,60481,60481,60481,60448,60449,60449,60449,60449,60417,60417,60417,60417,60417,60417,60417,60417,60450,60482,60547,60612,60741,60871,60969,63114,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,60807,58144,60553,65469,65535,65535,65535,65535,65535},
-    {65535,65535,65535,62896,60451,63283,63126,62608,61763,63974,63941,61926,62933,65469,65501,65469,65371,62998,62770,62901,63226,65469,65501,65469,62965,61958,63974,63909,61925,62998,65469,65469,63063,61926,63812,61764,64234,62900,63148,60674,58272,63055,63344,63275,63307,63307,63307,63307,63307,63307,63307,63307,63308,63308,63341,63343,63377,65491,65493,65526,65528,63251,60481,60480,60544,60448,62926,65535,65535,65535,65535,65535,65535,65535,65535,65535,62994,58272,60418,65363,63378,63243,63275,63243,63275,63243,63243,63243,63243,63243,63243,63243,63275,61032,60544,60512,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,60512,60512,60577,60772,61097,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61066,58337,58240,60968,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,63243,65459,65526,65526,65526,65526,65526,65526,65526,65526,65526,65493,63277,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,60936,58176,60583,65461,63310,63178,63178,63210,63210,63178,63210,63210,63178,63178,63210,63211,60870,60480,58208,60519,65437,65535,65535,65535,65535,65535,65535,65535,65535,65535,62995,58176,60550,65493,63278,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,61033,60578,58240,58242,63094,65535,65535,65535,65535,65535,65535,65535,63258,58341,58145,58305,60481,60481,60481,60448,60481,62889,63117,60546,60416,60449,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60482,60579,60774,60936,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60807,58144,60488,65437,65535,65535,65535,65535,65535},
-    {65535,65535,65535,62896,60386,63217,63156,63031,61861,63909,64006,63876,62250,63193,65469,65501,65501,65501,65501,65501,65501,65501,65501,65404,62607,61796,63974,63844,62023,63160,65501,65436,62673,61763,63844,61894,64625,63025,61032,60480,60353,63153,63310,63275,63275,63275,63275,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63307,63308,63341,63375,60970,60450,60713,60648,60714,65337,65535,65535,65535,65535,65535,65535,65535,65535,65535,63124,60353,60352,63216,65459,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,63243,61064,60576,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,60512,60512,60512,60643,61098,63243,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,61130,60483,58176,60839,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63210,63244,65458,65459,65459,65460,65460,65493,65493,65493,65525,65526,65526,63344,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,60936,58144,60583,65461,63278,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,60805,60416,58208,60618,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,63060,58209,60453,65428,63311,63178,63178,63178,63178,63178,63178,63178,63178,63146,63146,63178,61033,60578,58240,58242,63093,65535,65535,65535,65535,65535,65535,65535,65535,63060,58243,58145,58305,60449,60448,60645,63150,65492,65525,63150,60513,60416,60449,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60450,60774,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60807,58144,60423,65404,65535,65535,65535,65535,65535},
-    {65535,65535,65535,62896,58272,63085,63121,63258,62511,61731,63974,63974,61796,62348,63161,65469,65501,65501,65501,65501,65501,65469,65371,62803,61958,63941,63941,61731,62510,65404,65501,63193,62088,61731,61828,64364,62833,63147,60771,60416,60386,63249,63277,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63307,63307,63307,63307,63307,63307,63307,60740,60550,65403,65502,65534,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63223,60419,58272,63087,65492,63243,63243,63243,63243,63243,63243,63243,63211,63211,63211,63211,63243,61065,60577,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,60512,60512,60512,60512,60512,60871,63243,63211,63211,63211,63211,63210,63210,63211,63178,63178,63178,63210,63178,60548,58144,60774,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63210,63210,63211,63211,63212,63212,63244,63245,63277,63278,63278,63277,63211,63178,63178,63178,63178,63178,63178,63178,63178,63211,60936,58144,60583,65461,63246,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60772,60384,58176,60651,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63225,58307,60387,65363,63344,63146,63178,63146,63146,63178,63146,63146,63146,63146,63146,63178,61033,60578,58241,58210,63092,65535,65535,65535,65535,65535,65535,65535,65535,65502,60717,58145,58112,58306,62890,65394,65525,65524,65524,65492,63150,60548,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60482,60969,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60775,58144,58374,65404,65535,65535,65535,65535,65535},
-    {65535,65535,65535,62896,58272,62857,63182,63159,63193,62121,63844,63974,63974,61796,62186,62835,63160,63323,63323,63290,63096,62835,62380,61925,63941,63973,61731,62056,63095,65501,65436,62640,61763,61796,64234,64721,63021,60968,60544,60416,60418,65362,63276,63243,63243,63243,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63275,63243,60579,60650,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65404,60453,58240,62924,65493,63244,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61098,60641,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,60512,60512,60512,63019,63277,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60548,58144,60677,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,60936,58144,60616,65461,63246,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63146,60708,60384,58208,60782,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65404,60421,58241,63217,65425,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63114,60578,58241,58177,62961,65403,65403,63224,63126,63060,63027,62930,62929,60684,58211,58113,60453,63087,65492,65524,65524,65524,63344,63180,63279,63249,60679,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60418,63018,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60710,58113,58342,65404,65535,65535,65535,65535,65535},
-    {65535,65535,65535,60816,58272,60611,63148,63088,65372,63063,62088,61764,63941,63974,63909,61828,62088,62185,62218,62185,62023,61828,63909,63974,63909,61731,61991,62933,65436,65469,62933,61925,61731,64137,64689,62958,61098,60643,60512,60352,60483,63313,63243,63243,63243,63243,63243,63243,63243,61065,61000,61065,63146,63178,63210,63243,63243,63275,63275,63275,61130,60449,60782,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,60584,58240,60711,65493,63277,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63243,61098,60610,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,60512,60512,60677,65395,65492,63212,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60515,58144,60548,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63211,60936,58144,60615,65460,63245,63146,63178,63178,63178,63146,63178,63178,63178,63178,63178,63114,60643,60352,58208,62929,65470,65502,65535,65535,65535,65535,65535,65535,65535,65535,65469,60519,58144,63119,65458,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63114,60546,58241,58145,58275,58308,58243,58210,58210,58177,58177,58177,58145,58112,58210,60746,65394,65524,65524,65524,65458,63246,63114,63082,63114,63311,65426,62989,60548,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60385,60776,65426,63180,63081,63082,63082,63082,63082,63082,63082,63082,63082,63082,63114,60581,58113,58309,65403,65535,65535,65535,65535,65535},
-    {65535,65535,65535,62929,58272,60480,60839,63148,63093,65437,63095,62250,61796,63844,63973,63974,63941,63909,63909,63909,63974,64006,63974,63876,61731,62186,63030,65437,65469,63030,62056,61699,64137,64689,62926,63146,60772,60512,60544,60352,60614,63313,63211,63211,63211,63211,63211,63211,63210,60675,60544,60577,60577,60609,60642,60675,60740,60805,60837,60870,60804,60384,62961,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,60749,58240,60549,65461,63310,63210,63211,63211,63211,63211,63211,63211,63211,63211,63211,63211,63146,60642,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,60512,60512,60612,63217,65526,65526,63278,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63113,60481,58176,60450,63146,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60904,58144,60615,65460,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,61033,60545,58272,58176,60454,60585,60651,60782,62896,63027,63060,63093,63158,63159,65338,65436,60586,58144,63022,65459,63179,63178,63178,63146,63146,63146,63146,63146,63146,63146,63146,63081,60578,58241,58177,58241,58338,58340,60453,60486,60421,58145,58113,58113,60453,63119,65524,65524,65524,65524,63344,63147,63081,63082,63082,63082,63114,63278,65492,65362,62955,60613,60449,60417,60417,60417,60417,60417,60417,60385,60385,60384,60385,60516,62955,65426,65524,63311,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63049,60483,58081,58245,65371,65535,65535,65535,65535,65535},
-    {65535,65535,65535,63126,58273,60480,60545,61000,63085,63159,65469,63291,62802,62153,61828,61763,63844,63909,63941,63909,63876,61763,61861,62153,62738,63258,65501,65436,62966,60008,61763,64267,64721,62926,63146,60805,60481,60512,60512,58240,60713,63312,63210,63211,63211,63211,63211,63211,63145,60577,60544,60544,60544,60544,60544,60544,60512,60512,60512,60512,60512,60385,63093,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63027,58240,60420,65396,63343,63210,63211,63211,63211,63210,63210,63178,63178,63178,63178,63178,63146,60675,60512,60544,60544,60544,60544,60544,60544,60544,60544,60544,60512,60512,60513,60775,65297,65526,65525,65525,63245,63178,63178,63178,63178,63178,63178,63178,63146,63146,63178,60936,60449,58176,58338,61033,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60872,58112,60584,65460,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,61001,60546,58273,58177,58144,58144,58144,58144,58144,58144,58144,58177,58210,58242,58308,60422,58243,58144,60518,60745,60678,60710,60775,60968,63146,63114,63114,63114,63114,63114,63114,63114,60936,60970,63248,65329,65362,65395,65427,65395,60583,58081,58178,60778,65395,65524,65524,65524,65458,63214,63082,63081,63082,63082,63082,63082,63082,63082,63181,65458,65524,65427,63216,62988,60744,60646,60581,60581,60581,60614,60711,62922,63118,65394,65524,65524,65524,63311,63082,63082,63082,63082,63082,63082,63050,63082,63082,63082,60872,58306,58113,58245,65371,65535,65535,65535,65535,65535},
-    {65535,65535,65535,63191,58273,60480,60448,60644,63113,63053,63126,65437,65501,63290,62933,62608,62381,62186,62121,62251,62445,62608,62966,63291,65469,65501,63258,62673,61893,61894,64462,62769,62988,63146,60838,60481,60481,60512,60480,58208,60779,63312,63178,63178,63178,63178,63210,63211,60968,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60480,60420,65403,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63061,58209,58306,63250,63377,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60675,60512,60544,60544,60544,60544,60544,60544,60512,60512,60512,60578,60743,63119,65461,65526,65525,65525,63345,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60741,60416,58208,58273,60969,63178,63146,63146,63146,63146,63178,63178,63178,63178,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,60840,58112,60584,65460,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,61001,63116,63184,63119,63054,62957,62892,60778,60647,60518,60485,60453,60388,58307,58274,58241,58144,58112,58080,58080,58080,58112,58274,60904,63146,63114,63114,63114,63114,63114,63114,63114,63212,65524,65525,65525,65525,65525,65361,58242,58145,63054,65524,65524,65524,65524,63312,63115,63049,63082,63082,63050,63050,63082,63082,63050,63082,63049,63115,63279,65490,65524,65524,65524,65459,65427,65394,65395,65459,65524,65524,65524,65524,65524,65524,65426,63115,63049,63050,63050,63050,63050,63050,63050,63050,63050,63082,60645,58273,58113,58212,65371,65535,65535,65535,65535,65535},
-    {65535,65535,65535,63257,58307,60416,60481,60449,60709,63114,63052,63091,65339,65470,65502,65501,65436,65371,65371,65371,65436,65501,65501,65437,63258,62803,62185,61926,64300,64721,62863,63083,63146,60774,60481,60449,60481,60512,60384,58176,62923,63311,63178,63178,63178,63178,63178,63211,60837,60512,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,60384,60552,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63126,58242,58240,63119,65459,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60675,60512,60512,60512,60512,60512,60545,60610,60676,60808,63053,65329,65493,65526,65525,65525,65525,65425,63179,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,61001,60514,60449,58177,58209,60904,63178,63146,63146,63146,63146,61034,61066,61066,61066,63114,63114,63114,63114,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,63178,63178,63178,63146,63146,63146,63146,63146,63146,63146,63178,60839,58112,60584,65460,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63377,65526,65525,65525,65525,65525,65525,65525,65525,65492,65460,65395,65362,63250,63216,63119,63054,62957,62925,60811,60453,58112,60645,63114,63114,63114,63114,63114,63114,63114,63114,63147,65393,65393,63345,63344,63312,63149,58242,58113,60745,65459,65524,65458,63213,63050,63049,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63049,63049,63115,63246,65425,65491,65524,65524,65524,65524,65524,65524,65524,65524,65491,65458,63279,63115,63049,63050,63050,63050,63050,63050,63050,63050,63050,63082,60872,58338,58305,58113,58180,65339,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65437,60488,58305,60481,60481,60417,60676,61065,63114,63022,63093,63226,65404,65437,65469,65469,65436,65403,63193,62998,62673,62283,62122,64397,64720,62863,63020,63146,61033,60676,60417,60449,60481,60481,60480,58209,58176,63020,63245,63146,63178,63178,63178,63178,63178,60740,60512,60544,60544,60544,60544,60544,60544,60544,60544,60544,60544,58304,60782,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63224,58307,58208,62957,65492,63211,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,63178,60838,60741,62922,62955,63020,63117,63215,65330,65460,65525,65526,65525,65525,65525,65525,65491,63311,63179,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60709,60417,60449,58209,58145,60807,63178,63146,63146,63146,60741,60547,60547,60579,60579,60579,60579,60579,60579,60611,60611,60611,60611,60611,60611,60643,60643,60644,60644,60676,60675,60773,63114,63146,63146,63146,63146,63146,63146,63146,60807,58112,60584,65460,63212,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63344,65459,65459,65492,65492,65524,65524,65525,65525,65525,65525,65525,65525,65525,65525,65525,65525,65525,65525,65525,60778,58112,60613,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,63114,60936,58241,58113,58273,60778,63247,63115,63049,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63049,63049,63082,63147,63181,63279,63312,63344,63344,63344,63278,63213,63148,63114,63049,63049,63050,63050,63050,63050,63050,63050,63050,63050,63050,63049,60548,58305,58305,58113,58180,65339,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,60750,58241,60481,60481,60449,60417,60612,60936,63114,63050,62957,62928,62866,62900,62836,62803,62705,62575,62478,64590,62639,62831,62957,63051,63114,61033,60839,60547,60417,60449,60481,60481,60481,58273,58177,58208,63086,63213,63146,63146,63146,63146,63178,61065,60610,60512,60512,60544,60544,60544,60544,60544,60544,60544,60544,60512,58273,63059,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,60454,58176,60778,65493,63212,63178,63178,63178,63178,63178,63178,63146,63146,63146,63146,63146,63146,63179,65460,65525,65525,65526,65525,65525,65525,65525,65525,65525,65492,65458,63311,63212,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60871,60481,60417,60449,58241,58112,60710,63146,63114,63114,60904,60449,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60481,60936,63146,63114,63146,63146,63146,63114,63146,60807,58112,60584,65460,63212,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,63146,63147,63180,63213,63213,63245,63278,63278,63311,63312,63345,65425,65426,65459,65491,65491,65492,65492,65492,60649,58080,60645,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,63082,63114,60937,58241,58081,58273,58305,60613,60969,63082,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63049,63049,63049,63049,63050,63050,63050,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60710,58306,58306,58305,58113,58148,65339,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,63192,58275,60385,60481,60449,60417,60417,60482,60741,60936,63114,63114,63050,62922,60779,62828,62829,62860,62924,63019,63082,63114,61065,60936,60741,60547,60417,60417,60417,60417,60449,60481,60385,58243,60455,58274,63119,63180,63146,63146,63146,63146,63178,60968,58305,58240,58272,58273,58305,60384,60384,60416,60416,60448,60480,60448,58307,63192,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,60552,58176,60615,65492,63245,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63179,65459,65525,65525,65525,65524,65492,65492,65426,63344,63311,63245,63179,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,60936,60514,60417,60417,60449,58273,58112,60613,63146,63114,61034,60612,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60742,63146,63114,63114,63114,63114,63114,63146,60775,58112,60584,65459,63212,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63146,63146,63179,63180,63212,63181,60485,58080,60613,63114,63114,63114,63114,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60937,58242,58049,58241,58306,58305,60548,60904,63082,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60775,58338,58305,58306,58305,58113,58148,65339,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65502,60652,58209,60449,60449,60417,60417,60417,60417,60450,60612,60774,60904,61001,63081,61033,61065,61033,61001,60936,60839,60709,60548,60450,60385,60417,60417,60417,60417,60449,60449,60417,58177,60783,60685,58274,63183,63147,63114,63114,63114,63114,63146,60807,58209,60651,60815,60750,60652,60520,60455,60421,60388,58307,58274,58274,60618,65469,65535,65535,65503,59100,54715,61181,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,60651,58176,60484,65427,63278,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63178,63278,63279,63279,63278,63245,63212,63179,63146,63146,63114,63146,63146,63114,63146,63146,63146,63114,63114,63114,63114,63114,63114,63114,63146,60936,60547,60417,60417,60417,60449,58305,58113,60516,63114,63114,60807,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60580,63115,63114,63114,63114,63114,63114,63146,60743,58080,60584,65459,63212,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,61001,58338,58113,60613,63114,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60969,58243,58049,58241,58306,58306,58306,60451,60807,63017,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60775,58338,58274,58306,58306,58305,58081,58148,65339,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,63192,58244,58273,60449,60417,60417,60417,60417,60385,60385,60385,60418,60450,60482,60515,60515,60482,60450,60450,60386,60385,60385,60385,60417,60417,60417,60417,60417,60449,60417,58177,60554,65436,60619,58307,63183,63146,63114,63114,63114,63146,63146,60677,58242,63224,65535,65535,65503,65437,65404,65403,65370,65338,65338,63257,65436,65535,63422,56892,43896,35221,33014,37334,50394,63423,65535,65535,65535,65535,65535,65535,65535,65535,62962,58176,58306,65330,63344,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60904,60514,60417,60417,60417,60417,60449,58305,58113,60452,63114,60969,60515,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60450,63018,63114,63114,63114,63114,63114,63114,60742,58080,60583,65459,63212,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60968,58305,58113,60613,63082,63082,63082,63082,63082,63082,63050,63050,63050,63050,63050,63050,63050,63082,60969,58243,58049,58241,58306,58306,58306,58274,58306,60613,60904,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60969,60678,58306,58274,58274,58306,58306,58273,58081,58245,65371,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65503,62931,58178,58305,60449,60417,60417,60417,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60417,60417,60449,60385,58145,60521,65338,65535,60522,58241,60614,60677,60742,60774,60807,60872,60904,60483,58374,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61214,54715,41687,35126,32951,32987,35069,32984,33013,43767,59037,65535,65535,65535,65535,65535,65535,65535,63126,58209,58209,63151,65426,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63146,63114,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,61033,60774,60450,60417,60417,60417,60417,60449,60449,58305,58113,60516,63114,60709,60385,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60743,63147,63114,63114,63114,63114,63114,60742,58080,60584,65459,63212,63082,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60904,58273,58113,60581,63082,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,60969,58275,58017,58241,58306,58306,58306,58274,58274,58274,60419,60678,60904,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60872,60548,58274,58274,58274,58274,58306,58306,58241,58049,60424,65437,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65502,60685,58113,58305,60417,60417,60417,60417,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60417,60417,58305,58145,60521,65338,65535,65437,60455,58241,60385,60385,60385,60385,60385,60385,60450,58241,60554,65470,65535,65535,65535,65535,65535,65535,65535,65503,59069,50329,37398,32982,32985,35068,35102,35103,35103,35102,32987,32950,37302,50362,63391,65535,65535,65535,65535,65535,63192,58243,58144,62988,65459,63146,63114,63146,63146,63114,63146,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,60872,60580,60385,60385,60417,60417,60417,60417,60417,60449,58273,58080,60613,60904,60450,60385,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60483,63083,63114,63114,63114,63114,63114,60742,58080,60551,65459,63180,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63114,60839,58241,58081,60581,63082,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,61001,58275,58017,58241,58306,58306,58306,58274,58274,58274,58274,58274,60419,60678,60872,63017,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60872,60645,58338,58274,58274,58274,58274,58274,58306,58306,58177,58017,60654,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65404,60652,58145,58273,60417,60417,60417,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60385,58241,58146,60653,65371,65535,65535,65338,60325,58273,60385,60385,60385,60385,60385,60385,60385,58177,60816,65535,65535,65535,65535,65535,65535,63358,54747,43896,35221,32950,32986,35069,35102,35135,35166,35166,35166,35166,35103,35069,32984,32981,43767,56924,65535,65535,65535,65535,63290,58308,58144,60811,65459,63179,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,60872,60613,60418,60385,60385,60385,60417,60417,60417,60417,60417,60449,58209,58112,60678,60612,60385,60385,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60841,63115,63082,63082,63082,63114,60742,58080,60519,65459,63180,63049,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60775,58241,58049,60549,63082,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63049,58307,58017,58241,58306,58306,58306,58274,58274,58274,58274,58274,58274,58274,58338,60548,60775,60904,63017,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,63049,60937,60807,60581,58338,58274,58274,58274,58274,58274,58274,58274,58306,58306,58113,58050,62963,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65469,60784,58179,58177,60353,60417,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60385,60353,58241,58113,58245,62931,65502,65535,65535,65535,63225,58212,58273,60385,60385,60385,60385,60385,60385,60353,58178,63028,65535,65535,65535,65535,65535,59068,41687,35093,32984,35068,37374,39422,37246,37246,37246,37246,37246,37246,37246,37246,35134,35102,32987,32950,37269,50362,63390,65535,65535,65469,60520,58112,60647,65459,63212,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,60969,60807,60580,60418,60385,60385,60385,60385,60385,60385,60417,60417,60417,60417,60417,58145,58145,60581,60418,60385,60385,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60385,60581,63115,63082,63082,63082,63082,60742,58080,60486,65427,63180,63049,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63050,63082,60677,58209,58049,60549,63082,63050,63050,63050,63050,63049,63049,63050,63050,63049,63049,63049,60969,60937,60872,58243,58017,58209,58306,58306,58306,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58339,60548,60678,60807,60872,60937,63017,63017,63049,63049,63049,63049,63049,63049,63049,63017,60937,60872,60743,60613,60451,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58306,58241,58049,58213,65371,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63062,60425,58146,58177,58273,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58241,58177,58114,58278,60752,63258,65535,65535,65535,65535,65535,63192,58179,58273,60385,60385,60385,60385,60385,60385,58273,58244,65338,65535,65535,65535,65535,65535,48249,32950,35100,35134,45983,61215,54686,37310,37310,37310,37310,37278,37278,37278,37278,37246,37246,35135,35101,32984,32949,43800,56924,65535,65535,60586,58113,60483,65426,63246,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,60969,60807,60613,60483,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60449,58305,58081,58178,60418,60385,60385,60385,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60417,60449,60449,60449,60449,60449,60449,60449,60449,60449,60449,60449,60417,60417,60385,60418,60906,63050,61001,60969,60937,60645,58080,60452,65427,63212,63050,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,63082,60612,58209,58081,60581,63082,63049,63049,63049,63017,60969,60937,60872,60807,60742,60645,60581,60516,60451,58338,58113,58017,58113,58305,58306,58306,58306,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58274,58274,58338,60451,60516,60580,60613,60645,60677,60678,60678,60645,60613,60548,60451,58306,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58306,58145,58017,60653,65502,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65436,62996,60555,58212,58114,58145,58177,58209,58209,58209,58209,58177,58145,58113,58146,58245,60588,62964,65371,65535,65535,65535,65535,65535,65535,65535,63160,58147,58305,60385,60385,60385,60385,60385,60385,58241,60391,65437,65535,65535,65535,65535,65535,48185,32950,37213,41598,61151,65503,50366,39390,39390,39358,39358,37310,37310,37278,37310,37278,37278,37278,37214,35134,35035,32950,37334,59101,65535,60685,58113,58306,65329,63311,63081,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63114,63082,61001,60904,60807,60709,60580,60450,60385,60353,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60417,58177,58081,58209,58305,60385,60385,60385,60417,58273,58209,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58273,58273,58273,58273,58273,58273,58273,58273,58305,60417,60385,60385,60483,60580,60516,60483,60418,58273,58081,58242,60842,60775,60710,60742,60742,60710,60742,60742,60742,60742,60742,60742,60742,60710,60710,60710,60710,60710,60710,60710,60710,60710,60709,60709,60709,60709,60709,60677,60677,60677,60677,60677,60677,60482,58209,58081,60517,60840,60775,60710,60613,60548,60484,60419,58338,58306,58274,58274,58242,58274,58274,58274,58210,58049,58017,58145,58273,58306,58306,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58241,58241,58242,58274,58274,58274,58241,58241,58241,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58241,58017,58148,63159,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65470,63290,62996,60686,60588,60588,60588,60588,60588,60588,60653,60784,63159,65371,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,63192,58147,58209,58273,58305,58305,58337,60385,60385,58145,60621,65502,65535,65535,65535,65535,65535,48185,32950,35133,43838,65502,56830,39454,39389,39390,39390,39390,39390,39358,39358,39390,39358,39358,39358,37310,37246,35103,32986,32948,52506,65535,62995,58145,58209,63086,63344,63082,63114,63114,63114,63114,63114,63114,63082,63082,63082,61001,61001,60969,60936,60872,60807,60742,60677,60580,60483,60418,60385,60353,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60417,60417,58273,58081,58113,58273,58306,60385,60385,60385,60385,58113,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58081,58113,60385,60385,60385,58305,58305,58305,58305,58306,58209,58049,58145,58273,58273,58305,58305,58305,58305,58305,58305,58305,58305,58305,58305,58305,58273,58273,58273,58305,58305,58305,58305,58305,58305,58305,58273,58273,58273,58273,58273,58273,58273,58273,58273,58273,60353,58177,58081,58242,58306,58306,58274,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58177,58049,58017,58113,58274,58306,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58081,58017,60686,65502,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65437,60686,58245,58180,58147,58114,58113,58113,58145,58114,62996,65535,65535,65535,65535,65535,65535,48217,32949,37213,39454,50334,43805,41469,41501,39421,39421,39422,39390,39390,39390,39390,39390,39390,39390,39390,39358,35166,32987,32948,50394,65535,63192,58178,58145,60548,60678,60613,60613,60645,60645,60645,60613,60612,60580,60548,60515,60483,60482,60450,60418,60386,60385,60353,60353,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60417,60417,60385,58113,58081,58209,58306,58306,60385,60385,60385,58177,58081,58311,60718,60686,60653,60621,60621,60653,60621,60621,60620,60620,60620,60588,60555,60555,60522,60522,60522,60522,58212,58081,58241,60385,60385,58306,58306,58306,58306,58306,58241,58049,58145,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58145,58049,58210,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58177,58049,58017,58113,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58113,58017,58279,65339,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65338,63225,63160,63127,63094,62930,60686,62897,65437,65535,65535,65535,65535,65535,65535,50362,32981,37245,39358,39358,41469,41501,41501,41501,41501,39421,39421,39421,39421,39389,39389,39390,39390,39389,39390,37246,32987,32948,50394,65535,63225,58244,58145,60353,60385,60385,60353,60353,60353,60353,60353,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60385,58145,58081,58145,58273,58306,58306,60385,60385,58273,58049,58147,63127,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62930,58081,58145,60385,60385,58306,58306,58306,58306,58306,58241,58049,58145,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58113,58049,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58209,58049,58017,58081,58209,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58145,58017,58148,63094,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50362,32949,37245,39390,39421,41501,41501,41501,41501,41501,41501,39421,39421,39389,39421,39421,39421,39421,39389,39390,37246,32987,32948,50394,65535,65371,58310,58113,58273,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,60417,60385,58145,58049,58081,58241,58306,58306,58306,60385,60385,58145,58049,60653,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65338,58245,58081,58273,60385,58306,58306,58306,58306,58306,58242,58049,58145,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58305,58081,58081,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58081,58017,58017,58145,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58113,55937,58116,63029,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50458,32981,35165,39390,39422,41501,41501,41501,41501,41501,41501,41469,41469,39421,39421,39421,39421,39421,39389,39390,37246,32987,32948,50394,65535,65469,60457,58081,58241,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60417,58305,58113,58049,58081,58241,58306,58306,58306,58306,60385,58241,58049,58246,65339,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,60621,58049,58177,60385,58306,58306,58306,58306,58306,58241,58049,58113,58305,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58274,58049,58113,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58145,58017,55937,58049,58177,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58210,58049,55937,58181,63029,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52538,32981,37212,39390,39390,41501,41501,41501,41501,41501,41501,41501,41469,41469,39421,39421,39421,39421,39421,39390,37246,32987,32948,50394,65535,65535,60621,58081,58209,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58241,58081,58017,58113,58241,58306,58306,58306,58306,58306,58305,58113,58082,62897,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63127,58114,58081,58305,58306,58306,58306,58306,58306,58241,58049,58113,58273,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58241,58049,58113,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58177,58049,55937,55937,58081,58178,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58113,58017,55937,58279,63094,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52634,33013,35132,39422,39422,41501,41501,41501,41501,41501,41501,41501,39421,39421,39421,39421,39421,39421,39389,39358,37246,32987,32948,50394,65535,65535,62930,58081,58145,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58273,58145,58049,58049,58113,58273,58306,58306,58306,58306,58306,58306,58177,58049,60424,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65437,60424,58049,58209,58306,58306,58306,58306,58306,58242,58017,58081,58305,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58177,58017,58113,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58113,58017,55937,55937,58049,58145,58241,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58210,58113,58017,55937,58083,60654,65372,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59068,35125,35100,39390,39390,41501,41501,41501,41501,41501,41501,39421,39421,39421,39421,39389,39389,39389,39389,39357,37246,32987,32948,50394,65535,65535,63159,58146,58113,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58273,58177,58049,58049,58081,58177,58305,58306,58306,58306,58306,58306,58306,58241,58049,58115,63061,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62898,58017,58113,58306,58306,58306,58306,58306,58242,58017,58081,58273,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58177,58017,58145,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58209,58178,58146,58145,58081,58049,58017,58017,55937,55937,55937,55937,58017,58081,58145,58177,58242,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58209,58145,58049,58017,55937,58051,60491,63127,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61214,35158,35099,37310,39421,39421,41469,41501,41501,41501,39421,39421,39389,39389,39389,39389,39389,39389,39389,39357,37246,32987,32948,50394,65535,65535,63258,58147,58081,58305,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58209,58113,58049,58049,58049,58017,58081,58145,58177,58178,58209,58209,58241,58241,58241,58113,58017,60555,65470,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63258,58180,58017,58241,58306,58306,58306,58306,58241,58017,58081,58273,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58306,58145,58017,58177,58274,58274,58274,58274,58274,58274,58274,58274,58274,58274,58242,58242,58210,58178,58145,58113,58081,58049,58017,58017,58017,55937,55937,55938,58050,58116,58246,60491,60653,60719,60523,58148,55970,55937,55937,58017,58049,58113,58145,58178,58178,58210,58209,58209,58209,58210,58178,58178,58145,58081,58017,58017,55937,55970,58181,60589,63127,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61213,37301,32982,35132,37278,39390,39421,39421,39421,39421,39421,39389,39389,39389,39389,39389,39389,39389,39389,39358,35166,32987,32948,50394,65535,65535,65371,58278,58049,58241,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58273,58209,58145,58081,58049,58049,58179,58147,58082,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58213,63225,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,60588,58017,58113,58177,58177,58145,58113,58081,58017,58049,58209,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58241,58081,58017,58209,58274,58274,58274,58242,58242,58210,58177,58145,58081,58081,58049,58017,58017,58017,57985,55937,55970,58051,58148,58247,60425,60555,60719,63061,63159,63225,65371,65503,65535,65535,65502,63225,62996,60621,58344,58148,58018,55937,55937,55937,55937,57985,58017,58017,58017,58017,57985,55937,55937,55937,58083,58279,60588,62996,65338,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63390,43991,35124,32949,35065,35165,37278,39389,39357,39389,39389,39389,39389,39389,39389,39389,39389,39357,37278,37214,35103,32987,32948,50394,65535,65535,65502,60588,58049,58177,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,60385,58305,58273,58241,58209,58145,58081,58049,58017,58017,58115,60424,60784,63192,63160,63094,63029,60850,60718,60685,60555,60490,60457,58344,58279,58311,60425,63028,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63160,58181,58017,58017,58017,58017,58017,58050,58050,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58017,58113,58113,58081,58049,58017,58017,58017,55937,57985,55937,58050,58115,58214,58312,60490,60621,60785,63061,63127,63225,65404,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,63225,63094,60850,60621,60490,58345,58311,58279,58247,58247,58247,58312,60425,60589,62996,63160,65404,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,48599,39923,37397,32980,32951,35100,37246,37310,39358,39358,39357,39389,39389,39357,37278,37246,35166,35103,35102,35068,32952,32948,50426,65535,65535,65535,60751,58049,58145,58305,58305,58305,58305,58305,58305,58305,58305,58305,58305,58305,58305,58273,58273,58241,58241,58177,58145,58113,58081,58049,58017,58017,58017,58050,58180,60457,60817,63127,65469,65535,65535,65535,65535,65535,65535,65535,65535,65502,65502,65502,65502,65470,65470,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63160,60718,60588,60718,62898,62964,63029,62996,60490,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58246,58148,58017,57985,55937,55937,55970,58051,58148,58246,58377,60556,60785,62996,63062,63159,65404,65502,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65502,65502,65502,65470,65470,65469,65470,65502,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61276,48599,40116,37652,35124,32949,32985,35102,37246,37278,37278,37310,37246,37214,35135,35102,35069,32986,32951,32949,32980,35348,52729,65535,65535,65535,63127,58115,58049,58113,58113,58113,58113,58113,58113,58113,58081,58081,58081,58081,58049,58049,58049,58017,58017,58017,58017,58017,58082,58148,58246,60457,60752,62963,63258,65470,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65535,65535,65535,65535,65535,65470,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,65437,63192,60654,60490,60654,60818,62963,63094,63257,65437,65470,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63422,54938,44373,39923,37396,32948,32951,35068,35102,35134,35135,35103,35069,35068,32984,32949,32948,35124,35412,39860,40115,57050,65535,65535,65535,65470,60653,58147,58082,58082,58082,58082,58050,58050,58050,58082,58050,58082,58115,58115,58180,58213,58278,60424,60522,60686,60785,62996,63225,65404,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,59196,48631,40116,37652,35124,32949,32985,35069,35036,32985,32950,32949,33012,35316,37684,37971,40147,44373,50744,63422,65535,65535,65535,65535,65469,63225,63126,63061,63028,62996,62963,62995,62995,63028,63029,63127,63192,63290,65339,65371,65404,65436,65470,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63422,54938,44373,39924,35348,32948,32950,32949,32948,35220,37589,37875,38067,42292,46550,54970,61309,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65502,59228,48599,40148,37652,35284,35380,39828,40051,40179,46486,52824,59196,63454,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63422,54970,44373,38098,40179,44373,48631,57083,63390,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65502,59228,54970,55002,61309,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-
-};
-
-const uint16_t note[15][128] = {
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,54905,57116,65535,65535,65535,57018,55036,65535,65535,65535,65535,65535,65535,65535,65535,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,54969,57116,65535,65535,57083,59261,65535,65535,54937,57148,52824,61309,65535,65535,65535,65535,63389,54970,63455,65535,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,54904,38066,38066,40180,55003,65535,65535,65535,65535,65535,65535,65535,65535,57017,57084,65535,52824,59229,65535,65535,65535,65535,57050,61309,65535,65535,65535,65535,65535,65535,65535,65535,65502,46485,38066,38099,48664,63455,61276,50809,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,31531,19116,61342,65535,65535,37968,36021,65535,65535,65535,65535,65535,65535,65535,61276,33808,61342,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42193,33907,65535,65502,27370,36053,65535,65469,27436,48729,27371,50810,65535,65535,65535,65535,57017,27502,61342,59098,33841,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,33742,21164,35921,33775,21163,55004,65535,65535,65535,65535,65535,65535,65535,37903,38132,65535,29451,46617,65535,65535,65535,65502,31662,48697,65535,65535,65535,65535,65535,65535,65535,65535,63356,21032,29647,33840,21129,38133,52758,23374,63487,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,31564,12678,33939,65535,65535,37967,35988,65535,65535,59195,50712,54971,65535,65535,54872,18984,52890,63455,65535,63389,50744,52858,63455,65535,59196,63455,65535,65535,54871,25389,63455,61211,19016,27535,63487,59097,23308,59229,27338,46551,50744,52890,63455,65535,63389,52857,63455,50613,19050,55003,63455,65535,61309,50744,52890,63455,65535,65535,65535,65535,33742,40279,65535,65535,33677,40278,65535,65535,59163,50712,55035,65535,65535,37902,38100,65535,27403,46617,65535,65535,65535,65535,54937,61309,65535,61309,50744,52857,63422,65535,65535,65535,63356,23178,55068,65535,56984,21195,46484,23373,63487,65535,63389,52792,52857,63422,65535,61309,63455,65535,65535,61309,61342,65535,57018,50712,59229,65535,65502,57083,59163,50712,59229,65535,65535},
-    {65535,65535,65535,31596,40179,27436,44504,65535,37967,35988,65535,50646,23211,27501,23243,36020,63422,33774,6339,23341,55068,59163,29517,27534,27436,31793,59195,25323,52923,65535,65535,63389,25355,55036,50645,31760,31662,57181,46419,31793,65502,25192,17002,27501,21130,33907,63455,57049,25421,59228,29483,6372,27535,59261,59098,27436,27534,25356,33907,63455,65535,65535,65535,33742,27535,46486,42259,23243,52923,65535,48565,23211,27501,23243,40246,65535,37902,38100,65535,27403,46617,65535,65535,65535,65502,29549,48730,63356,29516,27502,25356,33906,63455,65535,65535,63356,23210,55068,65535,57017,21195,46484,23373,63487,59162,27436,27469,25356,29615,61310,38000,44471,65535,65502,33742,46584,44306,25356,29582,25324,50842,61275,21064,25388,27534,46584,65535,65535},
-    {65535,65535,65535,31564,44471,56984,23243,55036,37968,35988,63389,25290,46617,65535,59163,23210,50843,59098,21098,57148,65535,37968,31761,59196,57082,25290,46617,55002,63422,65535,65535,65535,35855,42358,38000,44504,38000,46584,33774,44504,65502,25225,40278,65535,59130,19049,55036,57016,21227,61375,54839,21163,59262,65535,35822,33939,59196,57017,23210,52891,65535,65535,65535,33709,16937,27534,27468,19050,46584,61308,23210,48730,65535,57049,21162,55068,37903,38100,65535,27403,46617,65535,65535,65535,65502,25323,48698,59130,19017,48697,59196,55003,65535,65535,65535,63356,21032,31760,38034,23210,36019,52758,23373,63487,35854,33907,63455,63421,31629,40246,52791,25389,61374,56984,23276,52824,21162,52890,59228,42193,27600,59195,19016,52891,65535,65535,65535,65535},
-    {65535,65535,65535,31564,42391,65535,46419,27535,33774,36021,61211,23211,61310,65535,65535,33677,42391,61211,23178,59262,65535,29515,19115,29582,29582,25324,48730,65535,65535,65535,65535,65535,50645,27534,29581,57149,50613,31727,25388,57149,65502,27338,50810,65535,65502,27338,50810,57016,21227,61375,56920,23244,63455,65502,25258,21196,29582,29582,23308,52923,65535,65535,65535,33742,40246,65535,65535,50613,23309,54904,23243,61375,65535,65535,29515,46617,37935,38100,65535,27403,46617,65535,65535,65535,65502,25323,48666,65535,48533,27501,25388,42390,65535,65535,65535,63356,20999,29615,35953,46519,63423,52758,23373,63454,27404,48730,65535,65535,46419,27601,65502,31629,44471,35855,38165,52758,14759,29582,29582,27469,31826,59162,23275,59262,65535,65535,65535,65535},
-    {65535,65535,65535,31564,42391,65535,65502,35887,8452,36021,63389,25290,46617,65535,59163,23210,50843,61243,21097,55068,65535,40048,31794,61309,61309,57083,63454,59228,63422,65535,65535,65535,61275,18919,23310,63455,59130,16838,25487,63455,65470,25290,50778,65535,65470,27338,50810,57016,21227,61375,56984,21130,59261,65535,35822,35987,61341,61309,57115,65535,65535,65535,65535,31662,38166,65535,65503,46452,23342,59195,23210,48730,65535,57050,14758,46617,40015,35987,65535,29451,44472,65535,65535,65535,65502,25323,48698,61308,55003,63422,52758,19050,59262,65535,65535,63356,23178,55068,65535,65535,65535,52758,21260,63454,35822,33907,63455,63421,29515,25456,65535,54871,21129,19083,57149,59098,23211,52923,63390,59163,61309,61242,23275,59262,65535,65535,65535,65535},
-    {65535,65535,65535,33710,44471,65535,65535,61308,21096,38133,65535,50646,23211,27502,23243,36019,63455,65502,35822,19082,50778,61243,29549,27502,29581,33873,61276,27403,48698,65535,65535,65535,65535,31564,33939,65535,65502,25290,40278,65535,65502,29484,50810,65535,65502,29484,50843,59097,25421,61375,63421,31628,21196,52955,59130,27468,27534,27501,35987,63455,65535,65535,65535,35854,16937,27469,25388,21130,46617,65535,46452,21130,27534,27501,16904,48698,52758,16937,46552,44306,19050,52891,65535,65535,65502,29517,50778,57017,23243,27501,25356,31761,63455,65535,65535,63356,27403,55068,65535,65535,65535,61243,23209,33906,57050,25323,25421,27534,21130,29714,65535,65502,25289,29746,65535,65503,44307,25356,29646,25421,52891,61275,25388,59262,65535,65535,65535,65535},
-    {65535,65535,65535,59163,61342,65535,65535,65535,61244,59261,65535,65535,59195,50712,54971,65535,65535,65535,63422,52824,59229,65535,63389,52824,50777,61342,65535,57050,61342,65535,65535,65535,65535,61244,61309,65535,65535,59163,61342,65535,65535,59163,63422,65535,65535,59163,63422,63422,57083,65535,65535,63389,50776,61310,65535,63389,52792,52857,61342,65535,65535,65535,65535,59163,48631,48631,48664,57148,65535,65535,65535,57083,50712,59196,59163,61342,65535,54938,57148,65502,52857,61309,65535,65535,65535,59163,61342,65535,61276,50744,52857,63422,65535,65535,65535,65503,57083,63455,65535,65535,65535,65535,59163,54970,65535,61309,50744,54970,61277,59196,65535,61276,25323,52955,65535,65535,65535,57082,50712,57116,65535,65502,57083,63455,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46451,29648,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57018,57084,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-
-};
-
-const uint16_t start[20][200] = {
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,59164,54938,54938,54938,54938,57083,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,55002,54938,54938,54938,54938,54938,54938,54938,54938,59164,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,57051,48631,46518,50712,59196,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,57083,14791,4226,4194,4194,4194,8420,21130,48599,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46486,8420,4226,4194,4194,4194,4194,4194,4194,2145,14791,59164,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52857,25356,6371,2113,32,2113,10597,38066,63422,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4258,6307,19017,19017,19017,12710,2113,6339,44405,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,38034,0,10565,19017,19017,19017,19017,19017,19017,19017,29582,61309,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,35921,31695,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52889,23243,48663,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52857,10597,2081,14823,29582,31695,25388,8420,2113,33808,63454,65535,65535,59228,25388,40179,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57083,23275,46486,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4226,19049,61341,63422,63422,61309,38066,4226,12678,57115,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,38034,0,35921,65503,63422,63422,63422,63422,63422,63422,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61341,14823,8484,57115,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42292,32,35921,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,27501,0,31695,61309,65535,65535,65535,52825,12710,4226,48663,65535,65535,52857,4226,21130,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,48599,2113,29582,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4226,21130,63422,65535,65535,65535,63454,25388,32,44373,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,38034,0,35953,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61341,14823,8484,57115,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42292,32,33840,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,16936,4226,52857,65535,65535,65535,65535,65535,48631,21162,52825,65535,65535,52857,4226,21130,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,48599,2113,27501,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4226,21130,63422,65535,65535,65535,65535,40179,0,33840,65535,57083,33840,54970,59164,40179,29582,33808,52857,65535,65535,65503,54938,38066,29582,31727,46518,61341,65535,65535,65535,65535,65503,52825,35985,27501,33808,46518,61309,65535,65535,65535,65535,57115,42260,29614,29614,40179,57083,65535,65535,65535,65535,65535,65535,65535,65535,65535,38034,0,35953,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61277,35953,50744,59196,42292,29614,31695,44405,61277,65535,65535,65535,63422,55002,14791,8452,52825,59228,63454,65535,65535,65535,65535,59164,42292,29614,29614,42260,59164,65535,65535,65535,65535,48599,35985,61309,52825,35921,27501,38066,59228,65535,65535,65535,65535,65535,65535,61341,38066,32,31695,59196,61309,65535,65535,65535,65535,63422,50712,35921,27501,33840,48631,63390,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,21162,2145,48599,65535,65535,65535,65535,65535,65535,63454,65535,65535,63422,48599,4226,19017,57115,61277,65535,65535,65535,65535,65535,57083,40179,29614,31695,44373,59228,65535,65535,65535,65535,65503,42260,42260,61341,48599,31727,29582,42324,63390,63390,44373,2113,25388,59196,61309,65535,65535,65535},
-    {65535,65535,65535,52825,4226,21130,63422,65535,65535,65535,65535,40147,0,35921,65535,40179,2081,23243,12710,2113,4194,2081,23275,63454,63422,35953,6339,2113,4258,4194,2113,23243,59164,65535,65535,65503,35953,6307,2081,4194,2113,2113,19049,54970,65535,65535,50712,12678,32,4194,2145,32,10565,44373,65535,65535,65535,65535,65535,65535,65535,65535,38034,0,35953,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46518,2113,14823,14791,2113,2113,0,2081,19017,54970,65535,65535,35985,8420,2113,32,6371,8484,44373,65535,65535,65535,46518,12678,2113,4226,4226,2081,14759,50712,65535,65535,63454,23243,4226,25356,6339,2113,2145,2145,40179,65535,65535,65535,65535,65535,57083,16904,4258,0,4226,8420,21162,61309,65535,65535,59196,25388,4194,2081,4194,2081,2113,23275,57083,65535,65535,65535,65535,65535,65535,65535,65535,65535,42260,2113,16872,48631,61341,65535,65535,65535,65535,65535,65535,63390,25356,6339,0,2113,8420,14791,54970,65535,65535,65503,42260,10565,32,2145,2113,32,16904,50712,65535,65535,65535,59196,10597,8484,23243,4226,2145,2113,6371,46486,21130,6307,0,4194,8420,16936,59164,65535,65535},
-    {65535,65535,65535,52825,4226,21130,63422,65535,65535,65535,61341,21130,2113,46518,65535,38098,0,2145,23275,46486,52825,48599,54938,65535,40147,2145,16936,46486,54970,50776,27469,2113,27469,63454,65535,52857,6339,12678,44373,52857,48631,27469,2145,33840,65535,63422,21130,4194,35921,52825,50776,35953,8452,16872,61309,65535,65535,65535,65535,65535,65535,65535,38034,0,16904,29582,29582,29582,29582,29582,44373,65503,65535,65535,65535,44405,2081,0,16872,42260,48663,44373,19049,0,21130,61341,65535,46486,21162,4258,2145,19049,23275,50744,65535,65535,52825,8484,8484,40147,54938,54938,35953,6339,14791,57115,65535,63454,21162,0,8420,33808,48631,50776,46550,59196,65535,65535,65535,65535,65535,61277,29614,14759,0,10597,21162,33840,63422,65535,63422,25356,32,19017,44373,52825,46486,21162,32,23211,61309,65535,65535,65535,65535,65535,65535,65535,65535,63390,31695,2145,4194,14791,23243,31727,46518,61309,65535,65535,63454,35985,16936,2081,6339,21130,27501,59196,65535,65535,44373,4226,8452,35953,50744,48631,29614,4226,12646,54938,65535,65535,59196,10565,0,12678,38034,50744,50712,48631,59196,33808,14823,32,8484,21162,31695,61309,65535,65535},
-    {65535,65535,65535,52825,4226,16936,54970,57083,57083,52825,27469,32,16936,61277,65535,38098,0,23243,63390,65535,65535,65535,65535,59164,10597,14791,59164,65535,65535,65535,63390,23243,6339,52857,65535,48631,2113,25388,65503,65535,65535,63422,48631,57083,65535,61309,12710,8484,57083,65535,65535,65535,54938,50744,65503,65535,65535,65535,65535,65535,65535,65535,38034,0,0,0,0,0,0,0,16936,61309,65535,65535,65535,44405,32,12678,57051,65535,65535,65535,59164,14823,2145,48631,65535,65535,61309,14823,8484,57115,65535,65535,65535,65503,25356,4258,48599,65535,65535,65535,65535,38066,2113,38098,65535,63454,21162,32,40147,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42292,32,33840,65535,65535,65535,65535,46518,2145,19017,59196,65535,65535,65535,61309,23211,2113,44373,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,46486,23275,10565,6307,2081,2113,19049,52889,65535,65535,65535,52857,4226,19049,63454,65535,65535,65535,59228,14791,6339,48599,65535,65535,65535,65503,35985,2081,27501,65503,65535,59196,10533,4258,48663,65535,65535,65535,65535,65535,65535,48599,2113,27501,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4258,2081,6307,6307,6307,4194,0,14759,52825,65535,65535,38098,0,38034,65535,65535,65535,65535,65535,46518,2113,29614,57051,54970,54970,54970,57051,35953,2113,42260,65535,59196,14791,4226,27469,46486,55002,63422,65535,65535,65535,65535,31695,2081,19017,40179,52857,61309,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,38034,0,25324,44405,44405,44405,44405,44405,52889,65535,65535,65535,65535,44405,0,27437,65535,65535,65535,65535,65535,33840,0,38034,65535,65535,61341,14823,8484,57115,65535,65535,65535,59196,10565,16872,52889,55002,54970,54970,55002,46550,6307,25356,65535,63454,21130,4258,52857,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42292,32,33840,65535,65535,65535,65535,31695,2081,44373,65535,65535,65535,65535,65535,46550,2113,27469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,59228,54970,44405,19049,0,16904,59196,65535,65535,52857,4226,19049,63454,65535,65535,65535,48631,2145,25356,65503,65535,65535,65535,65535,59196,12678,10565,59196,65535,59196,8484,12678,61277,65535,65535,65535,65535,65535,65535,48599,2113,27501,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4258,4226,14791,14823,16872,21162,35921,57083,65535,65535,65535,38098,32,38066,65535,65535,65535,65535,65535,42260,32,4194,4258,4258,4258,4258,4258,4194,0,38066,65535,65535,52825,21162,4258,2113,6339,19049,44405,63454,65535,65535,61277,31727,8452,2113,4226,12710,35921,59228,65535,65535,65535,65535,65535,65535,65535,65535,38034,0,35953,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44405,0,27501,65535,65535,65535,65535,65535,38066,0,33840,65535,65535,61341,14823,8484,57115,65535,65535,65535,54970,6371,2113,4258,4258,4258,4258,4258,4226,0,23211,63454,63454,21130,6307,54938,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42292,32,33840,65535,65535,65535,65503,23275,4226,52857,65535,65535,65535,65535,65535,54970,6339,19049,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59228,19017,32,42292,65535,65535,52857,4226,19049,63454,65535,65535,65535,42260,0,35921,65535,65535,65535,65535,65535,63454,19049,4258,54938,65535,59196,8484,12710,61309,65535,65535,65535,65535,65535,65535,48599,2113,27501,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4226,19049,61277,63390,63390,63454,65535,65535,65535,65535,65535,38098,0,38066,65535,65535,65535,65535,65535,44373,2081,21130,35921,33840,33840,33840,33840,33840,35985,57083,65535,65535,65535,63422,52857,42292,27501,8452,4226,40179,65535,65535,65535,65503,57083,46486,33808,14791,32,23275,63390,65535,65535,65535,65535,65535,65535,65535,38034,0,35953,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44405,0,27501,65535,65535,65535,65535,65535,38066,0,35921,65535,65535,61341,14823,8484,57115,65535,65535,65535,57051,8452,10597,33840,33840,33840,33840,33840,33840,35921,50712,65535,63454,21130,6307,54938,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42292,32,33840,65535,65535,65535,65535,25388,4194,50712,65535,65535,65535,65535,65535,52857,4258,23211,63454,65535,65535,65535,65535,65535,65535,65503,59196,63422,65535,65535,65535,65535,65535,65535,40179,0,33808,65535,65535,52857,4226,21130,63454,65535,65535,65535,44373,32,31727,65535,65535,65535,65535,65535,63422,16936,4226,52857,65535,59196,8484,12710,61309,65535,65535,65535,65535,65535,65535,48599,2113,27501,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4226,21130,63422,65535,65535,65535,65535,65535,65535,65535,65535,38098,0,38066,65535,65535,65535,65535,65535,52857,6307,23275,63422,65535,65535,65535,65535,65535,65535,65535,65535,63422,61277,65535,65535,65535,65535,48599,4226,19049,63422,65535,61277,63454,65535,65535,65535,59196,16936,6307,52857,65535,65535,65535,65535,65535,65535,65535,38034,0,35953,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44405,0,27501,65535,65535,65535,65535,65535,38066,0,35921,65535,65535,61341,16872,8452,57083,65535,65535,65535,61341,16904,10565,57083,65535,65535,65535,65535,65535,65535,65535,65535,63454,21130,6307,54938,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42324,32,33808,65535,65535,65535,65535,38066,0,33808,65535,65535,65535,65535,65535,38034,32,33808,65535,65535,65535,65535,65535,65535,65535,50776,12678,35921,65535,65535,65535,65535,65535,65535,35985,0,35921,65535,65535,52857,4226,19049,63422,65535,65535,65535,52857,6339,14823,59228,65535,65535,65535,65535,50744,6339,4258,52857,65535,59196,8484,12710,61309,65535,65535,65535,65535,65535,65535,48631,2113,27469,65535,65535,65535,65535,65535},
-    {65535,65535,65535,52825,4226,21130,63422,65535,65535,65535,65535,65535,65535,65535,65535,38098,0,38066,65535,65535,65535,65535,65535,63422,25388,2113,33808,61277,65535,65535,59196,40179,48631,65535,65535,38034,14791,42324,61341,65535,65503,46518,4226,21130,63454,52825,14791,31695,59164,65503,65535,57115,16904,6339,54938,65535,65535,65535,65535,65535,65535,65535,38034,0,33840,63454,63422,63422,63422,63422,63422,63422,63454,65535,65535,44405,0,27501,65535,65535,65535,65535,65535,38066,0,35921,65535,65535,63454,23275,2113,40147,61341,63454,65535,65535,40179,2113,21162,55002,65535,65535,63390,46486,42260,63422,65535,63454,21130,6307,54938,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50712,4194,16904,55002,63390,65535,65535,57051,10597,6339,42260,63390,65535,63422,44405,8452,8452,52889,65535,65535,65535,65535,65535,65535,65535,54970,10533,4258,38066,61309,65535,65535,63454,48631,10597,4226,48631,65535,65535,59164,10565,8452,50712,63390,65503,65535,63422,25356,0,27469,59164,65535,65503,52857,16936,0,6307,52857,65535,59196,8484,12710,61309,65535,65535,65535,65535,65535,65535,54938,6339,12678,52857,63390,65535,65535,65535},
-    {65535,65535,65535,52825,4226,21130,63422,65535,65535,65535,65535,65535,65535,65535,65535,38098,0,38066,65535,65535,65535,65535,65535,65535,57083,19017,2081,12710,27469,25388,12678,32,29582,65535,65535,38034,2145,2113,14823,25356,21130,6339,4226,42292,65535,52825,10565,0,10565,23243,23275,10597,32,25388,63422,65535,65535,65535,65535,65535,65535,65535,38034,0,8484,16936,16904,16904,16904,16904,16904,16904,27469,61277,65535,44405,0,27469,65535,65535,65535,65535,65535,38066,0,33840,65535,65535,65535,46518,4258,4194,10597,29614,63422,65535,63390,29614,2113,8452,23275,27501,16936,2113,14791,59228,65535,63454,21130,6307,54938,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63390,23243,0,8452,14823,50744,65535,65535,44405,8420,2113,16904,25356,16936,4194,6307,40211,65535,65535,65535,65535,65535,65535,65535,65535,65535,44373,8420,2081,12710,25388,27501,19049,4258,2113,31727,63454,65535,65535,65535,33808,32,6339,12678,42260,65535,65535,54970,14791,0,10597,23275,21130,6371,12678,8484,4258,52857,65535,59196,8484,12678,61309,65535,65535,65535,65535,65535,65535,63454,27501,0,8420,14791,46518,65535,65535},
-    {65535,65535,65535,57083,14823,31695,65503,65535,65535,65535,65535,65535,65535,65535,65535,46518,10565,44405,65535,65535,65535,65535,65535,65535,65535,59196,33840,14791,6339,6339,16904,35953,59196,65535,65535,63422,46486,23243,10565,4258,6371,16936,42292,63454,65535,65535,54938,29614,14791,6339,6307,12678,31727,59196,65535,65535,65535,65535,65535,65535,65535,65535,46518,8452,4258,4226,4226,4226,4226,4226,4226,4226,16872,59164,65535,52889,12678,38034,65535,65535,65535,65535,65535,46550,10597,44373,65535,65535,65535,65503,42292,14791,4258,25356,63422,65535,65535,63422,42292,19017,8420,6307,12678,29582,54938,65535,65535,65535,31695,14823,57083,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57083,25388,8420,8484,48599,65535,65535,65535,50744,25324,10565,4258,8484,23243,48631,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50744,25356,8452,2145,2145,4258,16904,40211,63422,65535,65535,65535,65535,61309,33808,10565,6307,38034,65535,65535,65535,57051,29582,10597,4258,10565,29582,54970,29582,16904,59164,65535,61341,21162,23243,63390,65535,65535,65535,65535,65535,65535,65535,59196,29582,8452,6371,44373,65535,65535},
-    {65535,65535,65535,65535,59196,61341,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,59164,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,61309,57083,57083,63390,65535,65535,65535,65535,65535,65535,65503,59196,55002,57083,63390,65535,65535,65535,65535,65535,65535,61309,57083,57051,61277,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,57083,54970,54970,54970,54970,54970,54970,54970,54970,59196,65535,65535,65535,59196,63422,65535,65535,65535,65535,65535,63454,59196,63454,65535,65535,65535,65535,65535,61309,57051,61309,65535,65535,65535,65535,65535,63422,57115,57051,61309,65535,65535,65535,65535,65535,61341,59196,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,57115,57115,65503,65535,65535,65535,65535,65503,59196,55002,59196,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,57115,52825,50776,54970,61341,65535,65535,65535,65535,65535,65535,65535,65503,59196,57051,63422,65535,65535,65535,65535,65503,59196,55002,59228,65503,65535,61341,59228,65535,65535,65535,61277,61277,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,59164,57083,63454,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-
-};
-
-const uint16_t gameIsOver[66][200] = {
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65470,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63455,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63324,56726,52175,47754,45543,45641,50029,54483,61146,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63486,61437,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61343,50878,40445,32093,30013,32061,34173,42526,52958,61375,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63389,54515,43430,38912,36864,36864,36864,36864,36864,38912,41188,52240,63292,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57339,26604,18408,47094,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61375,44638,27901,19548,17468,17436,17436,17436,17468,17468,21596,29981,48798,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63260,49964,38912,36864,38944,43431,47884,49997,49964,45673,41122,36864,38912,45608,61114,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,36849,2016,2016,16359,61437,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57183,34141,19548,17468,19548,25821,34173,38333,38333,34141,25789,19548,17468,19548,36285,61343,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63292,47754,38912,38912,45608,56726,63357,65535,65535,65535,65470,61082,49997,38945,36864,54483,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,40947,2016,2016,20457,63486,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59263,30013,17468,19516,29981,48798,61343,63455,65535,65535,63455,59263,46686,27869,19516,19516,34173,61343,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65470,50062,38912,38912,50062,63325,65535,65535,65535,65535,65535,65535,65535,65470,56628,49997,61114,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61437,38898,30702,53241,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,36253,17468,19548,38333,61343,65535,65535,65535,65535,65535,65535,65535,65535,57183,34141,19516,19516,40445,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,56726,38977,38912,49997,63389,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,48798,19548,17468,36253,61375,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59263,32061,17468,21661,52990,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,63390,45706,36864,43398,61179,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65470,65340,65308,65373,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65501,65468,65535,65535,65502,65468,65436,65469,65535,65535,65535,65535,65535,65502,65436,65436,65469,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65533,65532,65532,65532,65533,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61437,59388,65535,65535,65535,65535,65535,65535,65535,65535,63487,59391,59391,59391,61439,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61375,32061,17468,25821,57183,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,55070,23709,17468,36253,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,63359,63263,63295,63391,65535,65535,65535,65535,65535,65535,65535,65535,65439,65343,65503,65535,65535,65439,65343,65311,65407,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,58936,41058,38912,54450,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65372,64722,64138,63780,63683,63845,64235,64853,65437,65535,65535,65535,65535,65535,65535,65468,64970,64869,65303,65269,64970,64836,64803,64870,65103,65403,65535,65469,65203,64937,64835,64803,64869,65070,65402,65535,65535,65535,65535,65535,65535,65535,65535,65532,65521,65512,65507,65507,65507,65511,65520,65531,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59388,22506,10212,49143,65535,65535,65535,65535,65535,61439,40959,20479,10239,8191,8191,14335,30719,53247,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52990,21628,19516,42526,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,36253,17468,23741,57183,65535,61311,40191,48607,65535,65535,65535,65535,65535,65535,65535,65535,65535,54975,35967,54975,65535,65535,65535,65535,65503,58879,50047,43455,41183,41215,45631,52319,61183,65535,65535,65535,65535,65535,65471,64383,63807,64959,65407,64703,64063,63743,63711,63999,64863,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,54418,38912,41187,61146,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65048,63975,63488,63488,63488,63488,63488,63488,63488,64170,65242,65535,65535,65535,65535,65535,65401,64770,64704,64836,64737,64672,64704,64704,64704,64704,64902,65302,65003,64704,64672,64704,64704,64704,64704,64869,65368,65535,65535,65535,65535,65535,65535,65527,65510,65504,65504,65504,65504,65504,65504,65504,65511,65528,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,59391,24575,2047,2047,2047,2047,2047,2047,2047,8191,40959,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44606,19516,21661,55070,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50878,19548,19548,48830,65535,46527,63,10623,57119,65535,65535,65535,65535,65535,65535,65535,63423,23295,31,31711,65535,65535,65535,63359,52191,39007,36895,38943,38975,38943,36895,38943,43423,58879,65535,65535,65535,65535,65375,63903,63519,64255,64127,63519,63519,63519,63519,63519,64063,65439,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65503,49964,36864,45641,63390,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65048,63748,63488,63585,64268,64755,64852,64690,64170,63520,63488,64008,65275,65535,65535,65535,65535,65369,64770,64704,64704,64769,65036,65203,65169,64904,64704,64704,64769,64704,64737,65003,65202,65170,64936,64736,64704,64937,65469,65535,65535,65535,65535,65529,65509,65504,65505,65514,65523,65524,65523,65514,65504,65504,65510,65531,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,34815,2047,2047,16383,36863,43007,40959,26623,6143,2047,6143,49151,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,36253,17468,27901,61343,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57183,23709,17468,42526,65535,54975,8479,31,38079,65535,65535,65535,65535,65535,65535,65535,50751,4223,31,42335,65535,65535,65471,50111,38943,38975,47807,56607,58879,56767,52287,43327,36895,43327,61055,65535,65535,65535,65375,63903,63519,63519,63519,63999,64543,64735,64735,64671,65055,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65470,47754,36864,49964,65535,65535,65535,65535,65535,65535,65535,65470,63357,63325,63325,63325,63325,63389,65535,65535,65535,65535,65373,64008,63488,63748,64950,65503,65535,65535,65535,65470,64755,63618,63488,64333,65470,65535,65535,65535,65369,64770,64704,64769,65236,65535,65535,65535,65468,64969,64704,64704,64736,65170,65534,65535,65535,65469,65003,64704,64736,65302,65535,65535,65535,65533,65514,65504,65506,65523,65534,65535,65535,65535,65534,65520,65504,65504,65519,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,63487,18431,2047,12287,57343,65535,65535,65535,65535,47103,14335,12287,51199,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,34141,17468,32093,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61343,27869,17468,38365,65535,65535,31711,31,14815,59231,65535,65535,65535,65535,65535,65503,27519,31,16927,61279,65535,65535,56703,38975,38975,54431,65471,65535,65535,65535,65535,61055,43423,36895,47903,65471,65535,65535,65375,63903,63519,63551,64575,65407,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65470,47754,36864,50029,65535,65535,65535,65535,65535,65535,63389,50094,43365,43366,43366,43366,43365,45608,58968,65535,65535,65535,64788,63488,63521,64853,65535,65535,65535,65535,65535,65535,65503,64560,63488,63618,65080,65535,65535,65535,65369,64770,64704,65003,65502,65535,65535,65535,65535,65302,64736,64704,64936,65501,65535,65535,65535,65535,65336,64769,64704,65136,65535,65535,65535,65527,65505,65504,65519,65535,65535,65535,65535,65535,65535,65533,65514,65504,65509,65532,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,63487,18431,2047,16383,61439,65535,65535,65535,65535,65535,61439,59391,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,34141,17468,34173,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61343,27901,17468,38365,65535,65535,52863,6367,31,42303,65535,65535,65535,65535,65535,54943,6399,31,40191,65535,65535,65439,47775,36895,49983,65471,65535,65535,65535,65535,65535,65535,56671,38975,41183,61087,65535,65535,65375,63903,63519,64127,65439,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65502,47786,36864,47851,65503,65535,65535,65535,65535,65535,63292,43430,36864,36864,36864,36864,36864,36864,52240,65535,65535,65502,64203,63488,64105,65438,65535,65535,65535,65535,65535,65535,65535,65307,63813,63488,64560,65535,65535,65535,65369,64770,64704,65137,65535,65535,65535,65535,65535,65402,64803,64704,65070,65535,65535,65535,65535,65535,65435,64836,64704,65037,65535,65535,65535,65520,65504,65506,65529,65535,65535,65535,65535,65535,65535,65535,65524,65504,65505,65527,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,30719,2047,2047,28671,53247,61439,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,34173,17468,30013,63423,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59263,25821,17468,40445,65535,65535,63455,27487,31,19039,61311,65535,65535,65535,65535,33823,31,12735,59199,65535,65535,61119,41183,38975,58879,65535,65535,65535,65535,65535,65535,65535,63327,43423,38943,56671,65535,65535,65375,63903,63519,64511,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,50094,36864,45511,63357,65535,65535,65535,65535,65535,65535,58968,54483,54450,54482,52337,41187,36864,52207,65535,65535,65373,63910,63488,64560,65535,65535,65535,65535,65535,65535,65535,65535,65503,64235,63488,64203,65502,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65535,65516,65504,65505,65516,65517,65517,65517,65517,65517,65517,65517,65514,65504,65504,65523,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,55295,18431,2047,2047,4095,16383,26623,38911,55295,63487,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,38365,17468,25821,59263,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,55102,21629,19516,44638,65535,65535,65535,50719,4223,2111,46527,65535,65535,65535,57087,10591,31,35967,65535,65535,65535,58879,38975,38975,47839,50015,50015,50015,50015,50015,50015,50015,49983,41183,38943,52319,65535,65535,65375,63903,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,56628,38912,41058,58936,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63357,45511,36864,52207,65535,65535,65308,63813,63488,64755,65535,65535,65535,65535,65535,65535,65535,65535,65535,64398,63488,64105,65470,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65534,65514,65504,65504,65504,65504,65504,65504,65504,65504,65504,65504,65504,65504,65504,65524,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,65535,57343,32767,10239,2047,2047,2047,2047,6143,28671,57343,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46750,19548,21596,50878,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46686,19516,21628,52990,65535,65535,65535,63423,23295,31,23263,63423,65535,65535,38079,31,8511,57087,65535,65535,65535,56703,38943,38943,36895,36895,36895,36895,36895,36895,36895,36895,36895,36895,38943,54431,65535,65535,65375,63903,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,61147,43300,36864,50062,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,63357,43431,36864,52207,65535,65535,65372,63878,63488,64625,65535,65535,65535,65535,65535,65535,65535,65535,65535,64300,63488,64040,65438,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65534,65515,65504,65506,65517,65519,65518,65518,65518,65518,65518,65518,65518,65518,65522,65533,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,65535,65535,65535,59391,47103,36863,22527,8191,2047,2047,18431,57343,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57183,23741,17468,34173,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61375,30013,17468,27901,61343,65535,65535,65535,65535,48607,2143,4223,50719,65535,61279,14847,31,31743,65535,65535,65535,65535,58847,38975,41087,52223,54431,54431,54431,54431,54431,54431,54431,54431,54399,54495,63295,65535,65535,65375,63903,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,50127,36864,41122,58871,65535,65535,65535,65535,65535,65535,65535,65535,65535,63357,43431,36864,52207,65535,65535,65470,64105,63488,64235,65502,65535,65535,65535,65535,65535,65535,65535,65373,63910,63488,64040,65438,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65535,65519,65504,65507,65530,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63487,55295,26623,2047,2047,36863,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,36285,17468,21628,48830,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44638,19548,19516,42526,65535,65535,65535,65535,65535,63391,21183,31,27487,65535,44383,31,6399,54943,65535,65535,65535,65535,61087,41119,39007,58911,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65375,63903,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61114,43333,36864,43431,61114,65535,65535,65535,65535,65535,65535,65535,65535,63357,45511,36864,52207,65535,65535,65535,64593,63488,63618,65048,65535,65535,65535,65535,65535,65535,65535,64787,63488,63488,64040,65438,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65535,65526,65505,65504,65519,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,65535,61439,59391,65535,65535,65535,65535,65535,65535,55295,8191,2047,26623,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,55070,23741,17468,25821,55070,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50910,23709,17468,27901,59263,65535,65535,65535,65535,65535,65535,44447,63,6367,50719,21151,31,29599,65503,65535,65535,65535,65535,63391,45663,36895,49983,65471,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65375,63903,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,56628,38977,36864,43430,58839,65502,65535,65535,65535,65535,65535,65535,58936,41220,36864,52207,65535,65535,65535,65210,63748,63488,63975,65178,65535,65535,65535,65535,65535,65015,63748,63488,63488,64040,65438,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65535,65533,65513,65504,65505,65523,65534,65535,65535,65535,65535,65533,65525,65526,65534,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,53247,16383,16383,49151,65535,65535,65535,65535,65535,51199,6143,2047,28671,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44638,19548,17468,25821,48830,63455,65535,65535,65535,65535,65535,65535,63423,46686,23709,17468,21628,50878,65535,65535,65535,65535,65535,65535,65535,61311,16959,31,14815,2143,4255,50751,65535,65535,65535,65535,65535,65535,56607,38943,38975,54399,65471,65535,65535,65535,65535,65535,61055,56735,63391,65535,65535,65535,65375,63903,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,54418,38977,36864,41058,49964,56726,61114,61179,61146,58839,50094,41187,36864,38912,54515,65535,65535,65535,65535,64690,63520,63488,63813,64625,65080,65210,65048,64495,63650,63521,63618,63488,64040,65438,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65535,65535,65528,65507,65504,65505,65516,65526,65529,65529,65524,65513,65504,65505,65527,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,34800,65535,65535,65535,40959,2047,2047,6143,30719,47103,51199,51199,40959,14335,2047,2047,45055,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,40446,19548,17468,21628,34173,48798,55102,59263,59263,55102,46718,32061,19548,17468,21628,46718,65535,65535,65535,65535,65535,65535,65535,65535,65535,42303,31,31,31,25375,63423,65535,65535,65535,65535,65535,65535,63391,49983,38943,38975,47871,58847,61183,63263,58943,52255,41215,38943,56671,65535,65535,65535,65375,63903,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,56661,43333,36864,36864,38912,41122,41220,41155,38912,36864,36864,41122,54385,63390,65535,65535,65535,65535,65470,64593,63553,63488,63488,63521,63618,63520,63488,63618,64625,64170,63488,64040,65438,65535,65535,65369,64770,64704,65169,65535,65535,65535,65535,65535,65402,64803,64704,65103,65535,65535,65535,65535,65535,65436,64836,64704,65004,65535,65535,65535,65535,65535,65526,65509,65504,65504,65504,65505,65505,65504,65504,65504,65512,65531,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,53241,6114,2016,32751,65535,65535,65535,61439,28671,2047,2047,2047,2047,4095,2047,2047,2047,2047,28671,63487,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,46718,25789,17468,17468,19548,21628,25789,25789,21628,19516,17468,19516,27901,50878,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59231,14815,31,2175,48639,65535,65535,65535,65535,65535,65535,65535,65535,63327,50015,38975,36895,38943,41215,43295,39007,36895,38943,45567,61055,65535,65535,65535,65375,63871,63519,64575,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61147,52240,43398,38945,38912,38912,38912,38944,43333,50029,58969,65503,65535,65535,65535,65535,65535,65535,65502,64950,64170,63683,63488,63488,63715,64171,65015,65503,64625,63553,64463,65503,65535,65535,65435,64902,64769,65302,65535,65535,65535,65535,65535,65469,64936,64769,65236,65535,65535,65535,65535,65535,65501,64970,64736,65170,65535,65535,65535,65535,65535,65535,65530,65519,65509,65505,65504,65504,65506,65512,65522,65532,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57339,14310,4065,42996,65535,65535,65535,65535,63487,47103,24575,10239,2047,2047,2047,4095,16383,38911,61439,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57183,40445,27901,21628,19548,19516,19516,19548,21629,29981,44606,59263,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42271,4255,25375,63391,65535,65535,65535,65535,65535,65535,65535,65535,65535,65439,56703,47775,41215,38975,38943,41151,45599,54431,63295,65535,65535,65535,65535,65439,64159,63551,64799,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63325,58968,56726,56661,56693,58904,63292,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65470,65243,65080,65080,65275,65502,65535,65535,65437,65145,65405,65535,65535,65535,65535,65435,65369,65502,65535,65535,65535,65535,65535,65535,65435,65369,65502,65535,65535,65535,65535,65535,65535,65436,65369,65502,65535,65535,65535,65535,65535,65535,65535,65535,65532,65529,65528,65528,65529,65533,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57339,53241,63486,65535,65535,65535,65535,65535,65535,63487,57343,51199,51199,51199,53247,61439,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61343,55070,50878,46718,46750,50910,55102,63423,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63423,54943,61279,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65471,61183,58943,58911,61119,65439,65535,65535,65535,65535,65535,65535,65535,65311,65119,65471,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57049,40146,38066,38066,42326,57116,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52758,38066,38066,38066,38066,38066,38034,48697,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61276,48565,38066,42358,57149,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,50679,57149,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59196,61374,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,39981,66,12743,14791,12677,10664,44538,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,27269,2212,14791,14791,14791,14791,12711,31892,63487,65535,65535,65535,65535,65535,65535,65535,65535,65535,65534,46419,48763,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59097,38165,61407,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52725,16838,12711,14791,12710,12744,44537,65535,65535,59097,38165,61375,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63388,40179,55101,65535,65535,65535,65535,65535,65535,65535,65535,65535,59031,10466,29813,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61209,18853,34038,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37900,10893,59294,63454,61275,33611,10698,55134,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,25188,21555,63455,63422,63422,63422,63422,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65469,23175,27829,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50545,8713,57214,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63356,23045,21328,57149,63454,61276,37869,12746,55102,65535,50546,8713,57214,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61209,12709,40474,65535,65535,65535,65535,65535,65535,65535,65535,65535,39948,2080,10730,57182,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63388,40081,48731,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37900,10893,61407,65535,65535,59096,10597,42522,65502,54971,63422,57050,50712,59229,65535,65535,61276,52792,50777,59262,65535,65535,65535,65535,61243,50744,50809,61342,65535,65535,65535,63389,54905,50712,57116,65535,65535,65535,65535,65535,65535,65469,25220,23636,65535,65535,65535,65535,65535,65535,65535,63356,57083,63422,54937,50744,57149,65535,65535,65535,63356,23143,25749,63455,65535,65535,65535,65503,59130,50711,52890,63423,65535,65535,65470,54970,63422,59130,50712,57149,65535,65535,65535,65535,65535,48465,6633,55101,65503,65535,65535,65535,63389,54905,50712,57116,65535,65535,65535,65535,65535,65535,65535,61210,16676,40345,65535,65535,65535,63389,48567,61342,65535,48465,6633,55101,65503,65535,65535,65535,63389,54905,50744,57116,65535,65535,65535,65535,57050,61310,61276,50712,55003,63487,61144,10661,40441,65503,65535,65535,65535,65535,65535,65535,65535,61242,18853,27632,16805,38296,65535,65535,65535,65535,65535,61244,50744,50777,61310,65535,65535,65535,65535,65535,63389,54872,50712,57149,65535,65535,65535,65535,57083,61342,65535,65534,57051,61342,61243,50744,52890,63422,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37900,10893,61407,65535,65535,63290,12710,40410,56983,12743,27501,14758,8452,27667,63455,50580,18983,12710,12710,17002,46650,65535,65535,48466,16838,12710,10597,17003,48763,65535,61177,27337,12678,12678,12711,31892,61407,65535,65535,65535,65535,65469,25220,23636,65535,65535,65535,65535,65535,65535,65535,50513,14823,25355,12645,8452,10663,38166,63487,63323,29449,4193,4357,19082,48763,65535,63389,40015,14790,12742,12710,23375,57149,65535,59096,16837,27469,16838,8452,25553,61407,65535,65535,65535,48433,12612,66,12744,31859,63455,65535,54871,23176,10597,10597,12711,31892,61375,65535,65535,65535,65535,65535,65469,29416,17069,52955,63422,65535,65535,65535,65535,48433,12612,66,12743,31827,63455,65535,56984,25257,10597,10597,12711,33972,61375,65535,65436,27271,23308,21064,8452,17068,48598,21031,33,8550,23310,57182,65535,65535,65535,65535,65535,65535,48433,8552,52988,37803,17070,61375,65535,65535,65502,46321,16838,10597,10597,14890,44537,65535,65535,65535,54870,23144,10565,10597,12744,36118,63455,65535,63355,21064,38297,65535,63355,19016,21260,18951,8484,8485,21262,55069,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37900,12941,61407,65535,65535,50546,8518,50909,56918,4194,21327,52922,57115,59261,56951,16806,36086,59229,59195,37901,14890,57182,63355,18853,29780,59261,59130,35821,36118,65535,42062,10730,52955,61276,48499,25455,57214,65535,65535,65535,65535,65469,25220,6535,25388,25388,25356,27600,57149,65535,65535,48400,2081,27633,55003,57083,40014,8453,46683,65502,50612,14724,17166,44438,59229,65535,44207,14825,46650,61309,57017,25223,25554,63487,59063,10433,19182,50842,57115,59229,65535,65535,65535,65535,59097,33675,4422,36084,50810,65535,61210,20966,21327,52955,59196,48499,12613,34038,65535,65535,65535,65535,65535,65535,59129,29450,12711,19082,25422,42359,61374,65535,59097,33675,4390,36052,50810,65535,61242,20998,21327,52923,59196,48467,14693,36118,65535,63388,23011,8649,46584,57115,59196,61276,44273,6403,25617,46551,61374,65535,65535,65535,65535,65535,65469,27239,23473,65535,56885,10565,46683,65535,65535,52627,10533,36085,57148,57082,35821,10632,50876,65535,61177,18885,25489,55003,59195,46353,12645,38296,65535,63322,14757,34103,65535,63323,14691,8617,46585,59164,52758,18853,23473,63487,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,39948,6471,35986,38066,33774,12580,27634,63487,54838,6471,48828,65535,65535,65535,39949,17037,55036,59163,59164,54903,16805,40377,65469,25159,21295,50810,61309,65535,65535,65535,46353,10599,42359,57116,63455,65535,65535,65535,65535,65535,65535,65469,25220,6535,25388,25388,25356,29648,57181,65535,65535,48399,10664,57182,65535,65535,65436,23077,27764,65535,65469,23175,27829,65535,65535,65436,23047,29812,59196,57115,59196,46353,12744,55134,59063,12611,46683,65535,65535,65535,65535,65535,65535,65535,65535,50545,8714,57214,65535,65535,46320,10666,55134,65535,65535,65535,44174,12843,59295,65535,65535,65535,65535,65535,65535,63422,54905,46453,33774,12644,25553,61375,65535,50546,6665,57214,65535,65535,48401,10665,55134,65535,65535,65535,44174,12875,59295,65436,23044,31957,65535,65535,65535,65535,61209,12709,40474,65535,65535,65535,65535,65535,65535,65535,54837,10533,44603,65535,65469,27239,23506,63487,65501,27304,23506,63487,65535,65535,65436,25158,27700,65535,44174,12843,59262,65535,65535,65535,39916,14989,61407,63323,14757,34135,65535,63323,14725,34039,65535,65535,65535,48368,10568,55134,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,39948,66,12743,14791,19083,38166,61342,65535,54838,6536,50941,65535,65535,65534,31530,4324,16904,16904,16904,16904,10630,42457,65535,57016,29516,16904,14856,27633,55101,65535,63389,42160,21064,14791,21164,44505,65535,65535,65535,65535,65535,65469,25220,23636,65535,65535,65535,65535,65535,65535,65535,48399,14889,59295,65535,65535,65501,27304,21458,65535,65469,23175,27829,65535,65535,61242,12612,8583,16904,16904,16904,14791,14922,55134,59063,14692,48796,65535,65535,65535,65535,65535,65535,65535,65535,50545,6665,57214,65535,65535,37901,15055,63487,65535,65535,65535,52692,8616,55101,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52627,10501,46715,65535,50546,6665,57214,65535,65535,37901,15022,63455,65535,65535,65535,54772,8616,53054,65436,23044,36118,65535,65535,65535,65535,61209,12709,40474,65535,65535,65535,65535,65535,65535,65534,35723,8617,48697,52857,52889,35756,6472,55069,65436,18982,32055,65535,65535,65535,65535,35754,17232,65535,37674,21264,63487,65535,65535,65535,50514,12617,57214,63323,14757,34135,65535,63323,14790,38297,65535,65535,65535,52595,10501,53021,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37900,10893,59294,63422,63455,65535,65535,65535,54838,6536,50941,65535,65535,65535,37804,17070,55035,57083,57083,57083,59164,63422,65535,65535,65503,61276,50678,23078,23441,63487,65535,65535,63389,54969,37902,10568,50909,65535,65535,65535,65535,65469,25220,23636,65535,65535,65535,65535,65535,65535,65535,48399,14857,59295,65535,65535,65501,27304,21458,65535,65469,23175,27829,65535,65535,63355,20966,31893,59164,57083,57083,57083,59229,65535,59063,14692,48796,65535,65535,65535,65535,65535,65535,65535,65535,50545,6633,57214,65535,65535,44175,12811,59294,65535,65535,65535,46320,10730,57214,65535,65535,65535,65535,59097,42326,61375,65535,65535,65535,61176,14659,42457,65535,50546,6633,57214,65535,65535,44207,12779,59294,65535,65535,65535,48400,4423,53021,65436,23044,36118,65535,65535,65535,65535,61209,12709,40474,65535,65535,65535,65535,65535,65535,61209,14659,4292,12678,12678,12678,10564,2113,34071,65501,25191,27732,65535,65535,65535,65501,29351,15151,63487,42028,14988,61375,65535,65535,65535,44142,8488,57182,63323,14757,34135,65535,63323,14790,38297,65535,65535,65535,52595,10501,53021,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37900,10893,61407,65535,65535,65535,65535,65535,54838,6536,50941,65535,65535,65535,54805,12646,40343,63455,65502,57017,50778,65535,61177,33776,50843,63455,65502,35722,17069,61374,44209,40246,61342,65535,54837,12518,46683,65535,65535,65535,65535,65469,25188,21555,63455,63422,63422,63422,63422,63455,65535,48399,14857,59295,65535,65535,65501,27304,21458,65535,65502,31497,17102,59261,63455,65535,42029,14890,50875,65535,63422,52792,55036,65535,59031,14692,48796,65535,65535,65535,65535,65535,65535,65535,65535,54805,8485,44537,63454,65535,59064,14693,29812,61342,65502,56952,18885,27699,65535,65535,65535,65535,65535,56918,12612,29779,59229,63422,61276,37901,8552,52989,65535,54805,8485,42489,63422,65535,59063,14660,29812,61310,65502,56951,18852,2311,53021,65436,23044,36118,65535,65535,65535,65535,63355,18885,27700,61374,65535,65535,65535,65535,65535,46287,10632,50810,59164,57115,57115,59163,35722,12876,61375,46255,8551,44569,63455,63389,46386,8386,15152,63487,56918,12580,33973,61342,63454,54838,16707,6440,57182,63323,14757,34135,65535,63323,14790,38296,65535,65535,65535,52595,10501,53021,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,39981,15054,61407,65535,65535,65535,65535,65535,56886,8616,52989,65535,65535,65535,65502,46289,14758,16937,19049,14759,29779,63487,61210,25224,10598,16969,16904,12711,40345,65535,44176,10565,14856,19049,12678,23440,61343,65535,65535,65535,65535,65469,27269,2212,14791,14791,14791,14791,12711,31860,65535,48432,16970,59295,65535,65535,65502,29417,23539,65535,65535,54837,14692,10598,36086,65535,63356,33643,12711,19050,19016,14792,42489,65535,59063,14757,48796,65535,65535,65535,65535,65535,65535,65535,65535,65469,33610,8452,19117,57182,65535,50547,14758,14856,19016,12645,23375,57214,65535,65535,65535,65535,65535,65534,48499,16806,12710,14791,12710,10631,40312,65535,65535,65469,33610,8452,19117,57182,65535,48466,12645,12743,19017,16937,25387,8616,53053,65468,23077,36150,65535,65535,65535,65535,65535,46352,10500,12744,44570,65535,65535,65535,65469,27303,25619,65535,65535,65535,65535,65535,56885,10565,46715,63388,33675,8517,16937,19016,23342,27369,17232,63487,65534,46321,12613,14824,19048,17002,25290,12682,57214,63355,16870,36216,65535,63355,16871,38329,65535,65535,65535,54707,12646,53021,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57017,48730,65535,65535,65535,65535,65535,65535,63356,46551,61375,65535,65535,65535,65535,65535,57050,44339,40180,50810,63423,65535,65535,63389,52759,40146,40212,52955,65535,65535,65502,57050,44372,38066,46584,61374,65535,65535,65535,65535,65535,65535,52758,38066,38066,38066,38066,38066,38034,48697,65535,61210,48696,63487,65535,65535,65535,54904,52923,65535,65535,65535,57017,40179,50843,65535,65535,63422,52791,40147,42325,55036,65535,65535,63389,48598,61342,65535,65535,65535,65535,65535,65535,65535,65535,65535,63356,46453,42326,61375,65535,65535,59130,44372,38099,48697,61374,65535,65535,65535,65535,65535,65535,65535,65535,61243,46485,38066,42358,57116,65535,65535,65535,65535,63357,46485,42326,61375,65535,65535,59098,42259,40212,52955,61276,48632,61407,65502,50678,55069,65535,65535,65535,65535,65535,65502,52791,40180,57149,65535,65535,65535,65502,52759,55101,65535,65535,65535,65535,65535,65469,50678,59229,65535,63389,52759,40146,44439,61308,29416,25586,65535,65535,65535,57017,42227,40245,55036,61243,48632,63455,65502,50711,57149,65535,65502,50711,57181,65535,65535,65535,63356,48631,61375,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50579,25423,57149,65535,65535,50579,10566,44570,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59129,25224,12744,25389,25290,10565,31861,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63356,46484,33807,33873,48697,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
-
-};
-/* ********************************************* Main Function Area *************************************************** */
-
-// Main Function
-int main(){
-    
-    while(true){
-        // Initialise Memory Base
-        initial_memory_base();
-        
-        // Start Menu
-        while(!startGame){
-            
-            // Ending Menu
-            menu_screen();
-            
-            draw_pic_a(150,276,battle_of_balls[150][276],22,18);
-            draw_pic_b(15,128,note[15][128],96,200);
-            draw_pic_c(20,200,start[20][200],60,170);
-            
-            wait_for_vsync(); // swap front and back buffers on VGA vertical sync
-            pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
-            
-            // Erase any boxes and lines that were drawn in the last iteration
-            clear_screen();
-            
-            // code for keyboard input
-            keyboard_input();
-        }
-
-        // Press [Enter] to Enter the whole Game
-        while(startGame){
-            
-            cleartext();
-            // Initial Games
-            initial_game();
-            // code for keyboard input
-            keyboard_input();
-            
-            // Start one round Game
-            // Game won't stop until player is eaten
-            while(!endGame){
-                // Erase any boxes and lines that were drawn in the last iteration
-                clear_screen();
-            
-                // Balls Eating each other
-                game_react();
-            
-                // code for drawing the boxes and lines (not shown)
-                plot_game();
-            
-                // code for keyboard input
-                keyboard_input();
-            
-                // code for updating the locations of boxes (not shown)
-                update_game();
-                    
-                // code for text display
-                display_score();
-            
-                wait_for_vsync(); // swap front and back buffers on VGA vertical sync
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
-                
-                // Press [Space] to Puase Game
-                // Press [Enter] to Resume Game
-                while(pauseGame){
-                    // code for keyboard input
-                    cleartext();
-                    while(pauseGame){
-                        display_pausetext();
-                        keyboard_input();
-                    }
-                    cleartext();
-                }
-                
-                // Player win the Game
-                if(player.radius >= RESOLUTION_Y/2)
-                    endGame = true;
-                
-            }// One Round Game Finished
-            
-            restartGame = false;
-            
-            // Press [Enter] to Restart
-            while(!restartGame){
-                // Ending Menu
-                menu_screen();
-                draw_pic_d(66,200,gameIsOver[66][200],60,90);
-                for(int x=0;x<320;x++){
-                    for(int y=196;y<208;y++){
-                        plot_pixel(x,y,BLACK);
-                    }
-                }
-                display_endingtext();//dsiplay final score on the ending menu
-                wait_for_vsync(); // swap front and back buffers on VGA vertical sync
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
-                
-                // Erase any boxes and lines that were drawn in the last iteration
-                clear_screen();
-                
-                // code for keyboard input
-                keyboard_input();
-            }
-            
-        }// Whole Game Ended
-    }
-    
-    return 0;
-}
-
-/* ****************************************** VGA Related Functions Area ********************************************** */
-
-// Function 1: Wait for screen to be syncronised
-void wait_for_vsync(){
-    volatile int *pixel_ctrl_ptr = (int *) PIXEL_BUF_CTRL_BASE;
-    register int status;
-    
-    *pixel_ctrl_ptr = 1;
-    
-    status = *(pixel_ctrl_ptr + 3);
-    
-    while((status & 0x01) != 0){
-        status = *(pixel_ctrl_ptr + 3);
-    }
-}
-
-/* ******************************************* Initial Game Functions Area ******************************************** */
-
-// Function 2: Initialise Game Randomly
-void initial_game(){
-    // FIFO is Empty
-    byte1 = 0, byte2 = 0, byte3 = 0;
-    
-    // Game Not End
-    endGame = false;
-    
-    // Random generate seed
-    srand((unsigned)time(NULL));
-    
-    initial_player();
-    
-    initial_AI();
-    
-    initial_food();
-    
-    initial_score();
-    
-    // Opening Animation
-    opening();
-}
-
-// Function 3:
-void initial_memory_base(){
-    /* set front pixel buffer to start of FPGA On-chip memory */
-    // first store the address in the back buffer
-    *(pixel_ctrl_ptr + 1) = FPGA_ONCHIP_BASE;
-    
-    /* now, swap the front/back buffers, to set the front buffer location */
-    wait_for_vsync();
-    
-    /* initialize a pointer to the pixel buffer, used by drawing functions */
-    pixel_buffer_start = *pixel_ctrl_ptr;
-    
-    // pixel_buffer_start points to the pixel buffer
-    clear_screen();
-    
-    /* set back pixel buffer to start of SDRAM memory */
-    *(pixel_ctrl_ptr + 1) = SDRAM_BASE;
-    
-    // we draw on the back buffer
-    pixel_buffer_start = *(pixel_ctrl_ptr + 1);
-    
-    // Reset PS/2 Mouse
-    *PS2_ptr = 0xFF;
-}
-
-// Function 4: Random Generate Player Location
-void initial_player(){
-    // Initialise Player's Information
-    player.color = WHITE;
-    player.radius = 5;
-    player.isEaten = false;
-    
-    // Initialise Player's Location
-    player.xLocation = RESOLUTION_X/2;
-    player.yLocation = RESOLUTION_Y/2;
-    player.lastXLocation = RESOLUTION_X/2;
-    player.lastYLocation = RESOLUTION_Y/2;
-}
-
-// Function 5: Random Generate AI Balls
-void initial_AI(){
-    for (int i = 0; i < AI_NUM; i++){
-        AI[i].color = color[rand()%9];
-        AI[i].isEaten = false;
-        AI[i].radius = (int)(rand() % 10 + 3);
-        
-        AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-        AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-        
-        // AI Balls won't over the boarder
-        while(overlapPlayer(AI[i])){
-            AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-            AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-        }
-    }
-}
-
-// Function 6: Random Generate Foods
-void initial_food(){
-    for (int i = 0; i < FOOD_NUM; i++){
-        food[i].radius = 1;
-        food[i].color = color[rand()%9];
-        food[i].isEaten = false;
-        
-        food[i].xLocation = (int)(rand() % RESOLUTION_X);
-        food[i].yLocation = (int)(rand() % RESOLUTION_Y);
-        
-        while(overlapPlayer(food[i])){
-            food[i].xLocation = (int)(rand() % RESOLUTION_X);
-            food[i].yLocation = (int)(rand() % RESOLUTION_Y);
-        }
-    }
-}
-
-// Function 7: Initailise score as 100
-void initial_score(){
-    player.score=0;
-}
-
-/* ***************************************** Keyboard Input Functions Area ******************************************** */
-
-// Function 8: PS/2 Port Input Main Function
-void keyboard_input(){
-    int PS2_Data = *(PS2_ptr);
-    int ReadValid = PS2_Data & 0x8000;
-    
-    if(ReadValid){
-        byte1 = byte2;
-        byte2 = byte3;
-        byte3 = PS2_Data & 0xFF;
-        
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x75))
-            up_input();
-        
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x74))
-            right_input();
-        
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x6B))
-            left_input();
-        
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x72))
-            down_input();
-        
-        if((byte1 == (char)0x5A) && (byte2 == (char)0xF0) && (byte3 == (char)0x5A))
-            start_input();
-        
-        if((byte1 == (char)0x29) && (byte2 == (char)0xF0) && (byte3 == (char)0x29))
-            pause_input();
-    }
-}
-
-// Function 9: Press [Direction] Button to Move Balls
-void up_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 60) speed = 6;
-    if(player.radius > 120) speed = 4;
-    
-    if(player.yLocation - player.radius > 0){
-        player.lastYLocation = player.yLocation;
-        player.yLocation -= speed;
-    }
-}
-// Function 10:
-void right_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 60) speed = 6;
-    if(player.radius > 120) speed = 4;
-    
-    if(player.xLocation + player.radius < RESOLUTION_X){
-        player.lastXLocation = player.xLocation;
-        player.xLocation += speed;
-    }
-}
-// Function 11:
-void left_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 60) speed = 6;
-    if(player.radius > 120) speed = 4;
-    
-    if(player.xLocation - player.radius > 0){
-        player.lastXLocation = player.xLocation;
-        player.xLocation -= speed;
-    }
-}
-// Function 12:
-void down_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 60) speed = 6;
-    if(player.radius > 120) speed = 4;
-    
-    if(player.yLocation + player.radius < RESOLUTION_Y){
-        player.lastYLocation = player.yLocation;
-        player.yLocation += speed;
-    }
-}
-
-// Function 13: Press [Enter] Button to Start
-void start_input(){
-    pauseGame = false;
-    startGame = true;
-    restartGame = true;
-}
-
-// Function 14: Press [Space] Button to Pause or Resume
-void pause_input(){
-    pauseGame = true;
-}
-
-/* *************************************** Graphics Drawing Functions Area ******************************************** */
-
-// Function 15: Draw Main Function
-void plot_game(){
-    plot_player();
-    
-    plot_food();
-    
-    plot_AI();
-}
-
-// Function 16: Plot Food
-void plot_food(){
-    for(int i = 0; i < FOOD_NUM; i++){
-        if(!food[i].isEaten){
-            plot_circle(food[i]);
-        }else{
-            food[i].radius = 1;
-            food[i].color = color[rand()%9];
-            food[i].isEaten = false;
-            
-            food[i].xLocation = (int)(rand() % RESOLUTION_X);
-            food[i].yLocation = (int)(rand() % RESOLUTION_Y);
-            
-            while(overlapPlayer(food[i])){
-                food[i].xLocation = (int)(rand() % RESOLUTION_X);
-                food[i].yLocation = (int)(rand() % RESOLUTION_Y);
-            }
-        }
-    }
-}
-
-// Function 17: Plot AI Balls
-void plot_AI(){
-    for (int i = 0; i < AI_NUM; i++){
-      if (!AI[i].isEaten){
-          plot_circle(AI[i]);
-      }else{
-          AI[i].color = color[rand()%9];   //rand()%256  随机取值 0-255
-          AI[i].isEaten = false;
-          if(player.radius > 30)
-              AI[i].radius = (int)(rand() % 10 + player.radius/2 - 7);
-          else if(player.radius > 5)
-              AI[i].radius = (int)(rand() % 10 + player.radius - 5);
-          else
-              AI[i].radius = (int)(rand() % 6 + player.radius - 3);
-          
-
-          AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-          AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-          
-          // AI Balls won't over the boarder
-          while(overlapPlayer(AI[i])){
-              AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-              AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-          }
-      }
-    }
-}
-
-// Function 18: Plot Player
-void plot_player(){
-    plot_circle(player);
-}
-
-// Function 19: Plot pixels
-void plot_pixel(int x, int y, short int color){
-    if(x >= 0 && x < RESOLUTION_X && y >= 0 && y < RESOLUTION_Y)
-        *(short int *)(pixel_buffer_start + (y << 10) + (x << 1)) = color;
-}
-
-// Function 20: Plot Circle
-void plot_circle(Ball ball){
-    int x = ball.xLocation;
-    int y = ball.yLocation;
-    int r = ball.radius;
-    short int color = ball.color;
-    
-    int count = 0;
-    int d = 3-2*r;
-    
-    while(r > count){
-        draw_line(-count+x, r+y, count+x, r+y, color);
-        draw_line(-r+x, count+y, r+x, count+y, color);
-        draw_line(-count+x, -r+y, count+x, -r+y, color);
-        draw_line(-r+x, -count+y, r+x, -count+y, color);
-        
-        if(d < 0){
-            d = d + 4*count + 6;
-        }else{
-            d = d + 4*(count - r) + 10;
-            r--;
-        }
-        count++;
-    }
-}
-
-// Function 21: Plot lines
-void draw_line(int startX, int startY, int endX, int endY, short int color){
-    bool isSteep = (ABS(endY - startY) > ABS(endX - startX));
-    
-    if(isSteep){
-        swap(&startX, &startY);
-        swap(&endX, &endY);
-    }
-    
-    if(startX > endX){
-        swap(&startX, &endX);
-        swap(&startY, &endY);
-    }
-    
-    // Bresenham's Algorithm
-    int deltaX = endX - startX;
-    int deltaY = ABS(endY - startY);
-    int error = -(deltaX / 2);
-    int stepY;
-    
-    // y step
-    if(startY < endY){
-        stepY = 1;
-    }else if(startY > endY){
-        stepY = -1;
-    }else{
-        stepY = 0;
-    }
-    
-    // for loop
-    int y = startY;
-
-    for(int x = startX; x < endX; ++x){
-        if(isSteep){
-            plot_pixel(y, x, color);
-        }else{
-            plot_pixel(x, y, color);
-        }
-        
-        error = error + deltaY;
-        
-        if(error >= 0){
-            y = y + stepY;
-            error = error - deltaX;
-        }
-    }
-}
-
-/* *************************************** Graphics Update Functions Area ********************************************* */
-
-// Function 22: Update Main Fuction
-void update_game(){
-    AI_update();
-    update_score();
-}
-
-// Function 23: AI Movement
-void AI_update(){
-    for (int i = 0; i < AI_NUM; i++){
-        // check if the position is out of bounds
-        if((AI[i].xLocation - AI[i].radius) == 0){
-            AI[i].xLocation += 1;
-        }else if((AI[i].xLocation + AI[i].radius) == RESOLUTION_X){
-            AI[i].xLocation -= 1;
-        }
-        
-        if((AI[i].yLocation - AI[i].radius) == 0){
-            AI[i].yLocation += 1;
-        }else if((AI[i].yLocation + AI[i].radius) == RESOLUTION_Y){
-            AI[i].yLocation -= 1;
-        }else{
-            // Initialise as max distance
-            double minDistanceBall = RESOLUTION_X;
-            double minDistanceFood = RESOLUTION_X;
-            
-            // The Number of minmum ball
-            int minBall = -1;
-            int minFood = -1;
-       
-            // Find a smaller ball
-            if(!AI[i].isEaten){
-                // AI approaches AI
-                for (int k = i + 1; k < AI_NUM; k++){
-                    if (AI[i].radius > AI[k].radius && !AI[k].isEaten){
-                        // Store the Number of target ball
-                        if (findDistance(AI[i], AI[k]) < minDistanceBall){
-                            minDistanceBall = findDistance(AI[i], AI[k]);
-                            minBall = k;
-                        }
-                    }
-                }
-                
-                // AI approaches Food
-                for (int k = i + 1; k < FOOD_NUM; k++){
-                    if (minBall == -1 && !food[k].isEaten){
-                        // Store the Number of target ball
-                        if (findDistance(AI[i], food[k]) < minDistanceFood){
-                            minDistanceFood = findDistance(AI[i], food[k]);
-                            minFood = k;
-                        }
-                    }
-                }
-            }
-            
-            // Chase
-            if ((minBall != -1)){
-                AIChase(&AI[i], &AI[minBall]);
-            }else{
-                AIChase(&AI[i], &food[minFood]);
-            }
-        }
-    }
-}
-
-// Function 24: Chase Algorithm
-void AIChase(Ball *chase, Ball *run){
-    
-    int N = (chase->radius)/30;
-    double chaseSpeed = 21 / (chase->radius);
-    double runSpeed = 21 / (run->radius);
-    
-    if(chaseSpeed < 1) chaseSpeed = 1;
-    if(runSpeed < 1) runSpeed = 1;
-    
-    if(rand() % N == 0 || (N<1 && rand()%15 == 0)){
-        if(rand() % 2 == 0){
-            if(chase->xLocation < run->xLocation){
-                chase->xLocation += chaseSpeed;
-            } else {
-                chase->xLocation -= chaseSpeed;
-            }
-        } else {
-            if (chase->yLocation < run->yLocation){
-                chase->yLocation += chaseSpeed;
-            } else {
-                chase->yLocation -= chaseSpeed;
-            }
-        }
-        
-        if(run->radius != 1 && chase->radius >= 4*(run->radius)/3){
-            if(rand() % 2 == 0){
-                if(chase->xLocation < run->xLocation){
-                    run->xLocation -= runSpeed;
-                } else {
-                    run->xLocation += runSpeed;
-                }
-            } else {
-                if (chase->yLocation < run->yLocation){
-                    run->yLocation -= runSpeed;
-                } else {
-                    run->yLocation += runSpeed;
-                }
-            }
-        }
-        
-    }
-}
-
-/* ************************************** Graphics React Functions Area *********************************************** */
-
-// Function 25: Graphics React Main Function
-void game_react(){
-    playerEatFood();
-    AIEatFood();
-    playerEatAI();
-}
-
-// Function 26: Player Eat Food
-void playerEatFood(){
-    for (int i = 0; i < FOOD_NUM; i++){
-        if (!food[i].isEaten){
-            
-            if(player.xLocation != player.lastXLocation){
-                int midPoint = (player.xLocation + player.lastXLocation) / 2;
-                if((findDistanceForPlayer(food[i], player.xLocation, player.yLocation) < (player.radius + 3)) || (findDistanceForPlayer(food[i], midPoint, player.yLocation) < (player.radius + 3)) ){
-                        food[i].isEaten = true;
-                        player.radius += food[i].radius;
-                }
-            }else if(player.yLocation != player.lastYLocation){
-                int midPoint = (player.yLocation + player.lastYLocation) / 2;
-                if( (findDistanceForPlayer(food[i], player.xLocation, player.yLocation) < (player.radius + 3)) || (findDistanceForPlayer(food[i], player.xLocation, midPoint) < (player.radius + 3)) ){
-                        food[i].isEaten = true;
-                        player.radius += food[i].radius;
-                }
-            }
-
-        }
-    }
-}
-
-// Function 27: AI Eat Food & AI
-void AIEatFood(){
-    for (int i = 0; i < AI_NUM; i++){
-      if (AI[i].isEaten)
-        continue;
-        
-      // AI eat food
-      for (int j = 0; j < FOOD_NUM; j++){
-          if (!food[j].isEaten && findDistance(AI[i], food[j]) < AI[i].radius){
-            food[j].isEaten = true;
-            AI[i].radius += food[i].radius;
-          }
-      }
-        
-      // Ai eat Ai
-      for (int k = i + 1; k < AI_NUM; k++){
-        if (!AI[k].isEaten){
-            if (findDistance(AI[i], AI[k]) < AI[k].radius - AI[i].radius/3){
-                AI[i].isEaten = true;
-                if(AI[k].radius < 50) AI[k].radius += AI[i].radius / 5;
-                else AI[k].radius += AI[i].radius / 5;
-          }else if (findDistance(AI[i], AI[k]) < AI[i].radius - AI[k].radius/3){
-              AI[k].isEaten = true;
-              if(AI[i].radius < 50) AI[i].radius += AI[k].radius / 5;
-              else AI[i].radius += AI[k].radius / 10;
-          }
-        }
-      }
-    }
-}
-
-// Function 28: Player Eat AI or AI Eat Player
-void playerEatAI(){
-    for (int i = 0; i < AI_NUM; i++){
-        if (AI[i].isEaten)
-            continue;
-        
-        // Player Eat AI
-        if (findDistance(AI[i], player) < player.radius - AI[i].radius/3){
-            AI[i].isEaten = true;
-            player.radius += AI[i].radius / 4;
-            break;
-        }
-        
-        // AI eat player
-        else if (findDistance(AI[i], player) < AI[i].radius - player.radius/3){
-            endGame = true;
-            break;
-        }
-    }
-}
-
-/* ***************************************** Text Drawing Functions Area ********************************************** */
-
-// Function 29:
-void video_text(int x, int y, char * text_ptr) {
-    int offset;
-    volatile char * character_buffer =(char *)FPGA_CHAR_BASE; // video character buffer
-
-    offset = (y << 7) + x;
-    while (*(text_ptr)) {
-        *(character_buffer + offset) =*(text_ptr); // write to the character buffer
-        ++text_ptr;
-        ++offset;
-    }
-}
-// Function 30:
-void display_score(){
-    char str[20];
-    sprintf(str, "%d", player.score);
-    char text_top_left_first[40] = "Battle of Balls";
-    char text_top_left_second[40] = "Score:\0";
-    char text_bottom_middle[100] = "PRESS SPACE TO PAUSE / PRESS DIRECTION KEY TO CONTROL THE BALL\0";
-    strcat(text_top_left_second,str);
-    video_text(1, 1, text_top_left_first);
-    video_text(1, 3, text_top_left_second);
-    video_text(10, 58, text_bottom_middle);
-}
-// Function 31:
-void display_pausetext(){
-    char pause_text_bottom_row[40] = "PRESS ENTER TO RESUME\0";
-    video_text(30, 31, pause_text_bottom_row);
-}
-// Function 32:
-void display_endingtext(){
-    char str[20];
-    sprintf(str, "%d", player.score);
-    char ending_text[40]="Your Final Score is:\0";
-    strcat(ending_text,str);
-    video_text(30, 50, ending_text);
-}
-
-/* ***************************************** PNG Drawing Functions Area ********************************************** */
-
-// Function 33:
-void draw_pic_a(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,battle_of_balls[j-y][i-x]);
-        }
-    }
-}
-// Function 34:
-void draw_pic_b(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,note[j-y][i-x]);
-        }
-    }
-}
-// Function 35:
-void draw_pic_c(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,start[j-y][i-x]);
-        }
-    }
-}
-// Function 36:
-void draw_pic_d(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,gameIsOver[j-y][i-x]);
-        }
-    }
-}
-
-/* *************************************** Score Update Functions Area ************************************************ */
-
-//Function 37: upadate score
-void update_score(){
-    player.score=(player.radius-5)*10;
-}
-
-/* ******************************************* Open Scene & Ending Ssene Functions Area ******************************************* */
-
-// Function 38: Open Scene
-void opening(){
-    int x = RESOLUTION_X/2;
-    int y = RESOLUTION_Y/2;
-    short int color = WHITE;
-    
-    // Draw Circles
-    for(int r = RESOLUTION_X/2; r > 5; r--){
-        int count = 0;
-        int d = 3-2*r;
-        
-        while(r > count){
-            draw_line(-count+x, r+y, count+x, r+y, color);
-            draw_line(-r+x, count+y, r+x, count+y, color);
-            draw_line(-count+x, -r+y, count+x, -r+y, color);
-            draw_line(-r+x, -count+y, r+x, -count+y, color);
-            
-            if(d < 0){
-                d = d + 4*count + 6;
-            }else{
-                d = d + 4*(count - r) + 10;
-                r--;
-            }
-            count++;
-        }
-        
-        wait_for_vsync(); // swap front and back buffers on VGA vertical sync
-        pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
-        
-        // Erase any boxes and lines that were drawn in the last iteration
-        clear_screen();
-    }
-}
-
-/* ******************************************* Tool Functions Area **************************************************** */
-
-// Function 39: Find Distance Between Balls
-float findDistance(Ball ball1, Ball ball2){
-    return sqrt((ball1.xLocation - ball2.xLocation) * (ball1.xLocation - ball2.xLocation) + (ball1.yLocation - ball2.yLocation) * (ball1.yLocation - ball2.yLocation));
-}
-// Function 40:
-float findDistanceForPlayer(Ball ball1, int xLocation, int yLocation){
-    return sqrt((xLocation - ball1.xLocation) * (xLocation - ball1.xLocation) + (yLocation - ball1.yLocation) * (yLocation - ball1.yLocation));
-}
-
-// Function 41: the ball is overlap with the player
-bool overlapPlayer(Ball ball){
-    if(((ball.xLocation - ball.radius) < (player.xLocation + player.radius)) && ((ball.xLocation + ball.radius) > (player.xLocation - player.radius))){
-        if(((ball.yLocation - ball.radius) < (player.yLocation + player.radius)) && ((ball.yLocation + ball.radius) > (player.yLocation - player.radius))){
-            return true;
-        }
-    }
-    return false;
-}
-
-// Function 42: New balls won't overlap with old balls
-bool overlapAI(Ball ball){
-    for(int i = 0; i < AI_NUM; i++){
-        if(((ball.xLocation - ball.radius) < (AI[i].xLocation + AI[i].radius)) && ((ball.xLocation + ball.radius) > (AI[i].xLocation - AI[i].radius))){
-            if(((ball.yLocation - ball.radius) < (AI[i].yLocation + AI[i].radius)) && ((ball.yLocation + ball.radius) > (AI[i].yLocation - AI[i].radius))){
-                return true;
-            }
-        }
-    }
-    return false;
-}
-
-// Function 43: Swap
-void swap(int* a, int* b){
-    int temp = *a;
-    *a = *b;
-    *b = temp;
-}
-// Function 44: Clear text
-void cleartext(){
-    for(int x=0;x<80;x++){
-        for(int y=0;y<60;y++){
-            video_text(x, y, " \0");
-        }
-    }
-}
-// Function 45: Clear Screen
-void clear_screen(){
-    for(int x = 0; x < RESOLUTION_X; ++x){
-        for(int y = 0; y < RESOLUTION_Y; ++y){
-            if(*(short int *)(pixel_buffer_start + (y << 10) + (x << 1)) != BLACK)
-                plot_pixel(x, y, BLACK);
-        }
-    }
-}
-
-// Function 46: Clear Screen
-void menu_screen(){
-    for(int x = 0; x < RESOLUTION_X; ++x){
-        for(int y = 0; y < RESOLUTION_Y; ++y){
-            if(*(short int *)(pixel_buffer_start + (y << 10) + (x << 1)) != WHITE)
-                plot_pixel(x, y, WHITE);
-        }
-    }
-}
+#include "Project_BattleOfBalls.c"
@@ -77,6 +77,15 @@
 /* Absolute Value */
 #define ABS(x) (((x) > 0) ? (x) : -(x))
 
+/* Game Variants */
+// Every tuning constant lives here, so each fork builds from this one file
+// 243FinalVersion.c sets GAME_VARIANT and includes this file
+#define VARIANT_PROJECT 0                               // Speed ladder 40/80/120
+#define VARIANT_FINAL 1                                 // Speed ladder 60/120, as shipped in 243FinalVersion.c
+#ifndef GAME_VARIANT
+#define GAME_VARIANT VARIANT_PROJECT
+#endif
+
 /* Screen size */
 #define RESOLUTION_X 320
 #define RESOLUTION_Y 240
@@ -85,6 +94,175 @@
 #define FOOD_NUM 50
 #define AI_NUM 10
 
+/* Player Speed Ladder */
+// Pixels per key press: 80 / radius, then 8, and slower above each step
+#if GAME_VARIANT == VARIANT_FINAL
+#define SPEED_STEP_6 60                                 // Above this radius the player moves 6
+#define SPEED_STEP_4 120                                // 4
+#define SPEED_STEP_2 SPEED_TABLE_SIZE                   // 2, never reached
+#else
+#define SPEED_STEP_6 40
+#define SPEED_STEP_4 80
+#define SPEED_STEP_2 120
+#endif
+
+/* Growth */
+#define WIN_RADIUS (RESOLUTION_Y / 2)                   // Player wins at this radius
+#define PLAYER_EAT_REACH 3                              // Player eats food this far outside its edge
+#define PLAYER_EAT_AI_DIVISOR 4                         // Player gains radius / 4 of an eaten AI
+#define AI_EAT_AI_SMALL_DIVISOR 5                       // AI below AI_GROWTH_SPLIT gains radius / 5
+#define AI_EAT_AI_LARGE_DIVISOR 10                      // and radius / 10 above it
+#define AI_GROWTH_SPLIT 50
+#define SPAWN_TRIES 1000                                // A ball respawns overlapping the player after this many tries
+
+/* Live Lists */
+#define LIVE_MAX ((FOOD_NUM > AI_NUM) ? FOOD_NUM : AI_NUM)
+#define LIVE_WORDS ((LIVE_MAX + 31) / 32)
+
+/* Arenas */
+#define ARENA_ALIGN 8
+// Sized for the worst frame and round, arena_report shows how much is really used
+#define FRAME_ARENA_SIZE (MAX_DRAW_COMMANDS * sizeof(DrawCommand) + EAT_EVENT_MAX * (sizeof(EatEvent) + sizeof(int)) + 2 * CIRCLE_SET_MAX + SPAN_SPILL_SIZE + (9 + AI_NUM) * ARENA_ALIGN)
+#define ROUND_ARENA_SIZE (sizeof(CircleSet) + 3 * SCHEDULE_PAIRS * sizeof(int) + 4 * ARENA_ALIGN)
+
+/* Proximity Kernel */
+#define CIRCLE_SET_MAX FOOD_NUM                         // Circles one query can test
+#define PAIR_PLAYER AI_NUM                              // Pair cache slot of the player, after the AIs
+#define PAIR_SLOTS (AI_NUM + 1)
+
+/* Eat Events */
+#define ENTITY_PLAYER 0
+#define ENTITY_AI 1
+#define ENTITY_FOOD 2
+#define EAT_EVENT_MAX (FOOD_NUM + AI_NUM * FOOD_NUM + AI_NUM * AI_NUM + AI_NUM)  // Every pair at once
+
+/* Collision Schedule */
+// Pairs are AI-food first, then every two movers, the AIs and the player in pair cache slots
+#define SCHEDULE_FOOD_PAIRS (AI_NUM * FOOD_NUM)
+#define SCHEDULE_PAIRS (SCHEDULE_FOOD_PAIRS + PAIR_SLOTS * PAIR_SLOTS)
+#define SCHEDULE_HORIZON 64                             // Frames a pair can be put off, a later one is looked at again then
+#define SCHEDULE_NEVER UINT_MAX                         // Pair that cannot touch until one of its balls changes
+
+/* Fixed Point */
+#define FIXED_SHIFT 16                                  // Kinematics use 16.16 fixed point
+#define FIXED_ONE (1 << FIXED_SHIFT)
+#define INT_TO_FIXED(x) ((x) * FIXED_ONE)
+#define FIXED_TO_INT(x) ((x) >> FIXED_SHIFT)
+#define SPEED_TABLE_SIZE 256                            // Speeds are looked up by radius
+#define FIXED_DIAGONAL 46341                            // 1 / sqrt(2) in 16.16
+
+/* Held Keys */
+#define ARROW_UP 0x1                                    // Bits of keyState
+#define ARROW_RIGHT 0x2
+#define ARROW_LEFT 0x4
+#define ARROW_DOWN 0x8
+#define TICKS_PER_STEP 8                                // A held key covers the distance of one old key press step over this many ticks
+
+/* Influence Map */
+#define INFLUENCE_CELL 16                               // Cell size in pixels
+#define INFLUENCE_COLS (RESOLUTION_X / INFLUENCE_CELL)
+#define INFLUENCE_ROWS (RESOLUTION_Y / INFLUENCE_CELL)
+#define INFLUENCE_PERIOD 8                              // Frames between two rebuilds
+#define INFLUENCE_FOOD_WEIGHT 64                        // Weight of one food in its cell
+#define INFLUENCE_DECAY 4                               // Weight lost per cell away from food
+#define INFLUENCE_THREAT_PENALTY 1024                   // Cells covered by a larger ball are avoided
+#define HUNT_RANGE 40                                   // AI only chases AI closer than this
+#define TARGET_HYSTERESIS 4                             // A kept target may drift this far past HUNT_RANGE
+#define TARGET_SWITCH_PERCENT 80                        // A refresh only switches to prey below this share of the squared distance
+#define TARGET_REFRESH_PERIOD 8                         // Frames between two full prey searches of one AI
+
+/* Tile Renderer */
+#define TILE_SIZE 32
+#define TILE_COLS ((RESOLUTION_X + TILE_SIZE - 1) / TILE_SIZE)
+#define TILE_ROWS ((RESOLUTION_Y + TILE_SIZE - 1) / TILE_SIZE)
+#define MAX_DRAW_COMMANDS (AI_NUM + FOOD_NUM + 8)
+#define SPAN_CACHE_SIZE 4096                            // Memory cap of cached circle half widths, in shorts
+#define SPAN_CACHE_ENTRIES 64                           // Radii cached at once
+#define SPAN_CACHE_MAX_RADIUS 255                       // Larger circles get their spans in the frame arena
+#define DRAW_MAX_RADIUS (RESOLUTION_X + RESOLUTION_Y)    // Bigger circles centred near the playfield cover it all the same
+#define SPAN_SPILL_SIZE ((AI_NUM + 1) * (2 * DRAW_MAX_RADIUS + 1) * sizeof(short int))   // Spans of circles the cache cannot hold
+
+#define DRAW_CIRCLE 0
+#define DRAW_RECT 1
+#define DRAW_SPRITE 2
+#define DRAW_POINTS 3                                   // Run of tiny circles drawn from stencils
+
+#define RENDER_BANDS TILE_ROWS                          // Tile rows are rasterized in this many bands, one after another, feeding the codec in between
+
+
+#define POINT_MAX_RADIUS 2                              // Circles up to this radius are points
+#define MAX_POINTS (AI_NUM + FOOD_NUM)
+
+/* Presentation */
+#define TRIPLE_BUFFERING 0                              // 0: two buffers, 1: three buffers with a present queue
+#define THIRD_BUFFER_BASE (SDRAM_BASE + 0x00040000)     // Right after the SDRAM back buffer
+#if TRIPLE_BUFFERING
+#define FRAME_BUFFER_NUM 3
+#else
+#define FRAME_BUFFER_NUM 2
+#endif
+
+/* Audio */
+#define AUDIO_SAMPLE_RATE 8000                          // Codec sample rate
+#define AUDIO_RING_SIZE 1024                            // Mixed samples waiting for the codec, power of 2
+#define AUDIO_LEAD_SAMPLES (AUDIO_SAMPLE_RATE / 20)     // Mixed ahead of the codec, bounds effect latency
+#define AUDIO_VOICE_NUM 4                               // Voice 0 plays music, the others sound effects
+#define SINE_TABLE_SIZE 256
+#define MUSIC_NOTE_SAMPLES (AUDIO_SAMPLE_RATE / 5)
+#define MUSIC_VOLUME 48                                 // Out of 256
+#define SFX_VOLUME 160
+#define SFX_EAT 0
+#define SFX_GULP 1
+#define SFX_EAT_SAMPLES (AUDIO_SAMPLE_RATE / 16)
+#define SFX_GULP_SAMPLES (AUDIO_SAMPLE_RATE / 6)
+
+/* Headless Sessions */
+#define HEADLESS_SERVER 0                               // 1: run many worlds without video instead of the game
+#define SESSION_NUM 1000                                // Worlds kept by the headless server
+#define SESSION_SLICE 32                                // Ticks a worker runs a world before it can be stolen
+#define SESSION_TICKS 100000000                         // Total ticks of one server run
+#define SESSION_STEER_TICKS 16                          // Ticks the autopilot holds the same keys
+#define SERVER_THREADS 0                                // Workers of the server pool, 0: one per online core
+#define SERVER_THREADS_MAX 64
+#define TIMER_FREQUENCY 200000000                       // A9 private timer clock in Hz
+
+/* Seven Segment Readout */
+#define HEX_DIGITS 6                                    // HEX5 to HEX0
+#define SW_SHOW_FPS 0x1                                 // SW0: frames presented per second
+#define SW_SHOW_ENTITIES 0x2                            // SW1: balls alive, player included
+
+/* Batch Environment */
+#define BATCH_MAX 64                                    // Worlds stepped together by batch_step
+#define ACTION_NONE 0
+#define ACTION_UP 1
+#define ACTION_RIGHT 2
+#define ACTION_LEFT 3
+#define ACTION_DOWN 4
+
+/* World Snapshot Blob */
+#define SNAPSHOT_VERSION 5
+#define SNAPSHOT_HEADER_SIZE 26
+#define SNAPSHOT_CRC_OFFSET 22                          // CRC-32 of every other byte of the blob
+#define SNAPSHOT_BALL_SIZE 17
+#define SNAPSHOT_LIVE_SIZE ((2 + AI_NUM + FOOD_NUM) * 2)
+#define SNAPSHOT_TARGET_SIZE (AI_NUM * 2)
+#define SNAPSHOT_MAP_SIZE (3 * INFLUENCE_ROWS * INFLUENCE_COLS * 2)
+#define SNAPSHOT_MAX_SIZE (SNAPSHOT_HEADER_SIZE + (1 + AI_NUM + FOOD_NUM) * SNAPSHOT_BALL_SIZE + SNAPSHOT_LIVE_SIZE + SNAPSHOT_TARGET_SIZE + SNAPSHOT_MAP_SIZE)
+#define SNAPSHOT_END_GAME 0x1
+#define SNAPSHOT_PAUSE_GAME 0x2
+#define SNAPSHOT_HAS_MAP 0x4
+#define SNAPSHOT_MAX_RADIUS (8 * WIN_RADIUS)            // AIs keep growing, but none came near this in play
+#define SNAPSHOT_EDGE_SLACK 64                          // Chasing AIs drift a few pixels past the right and bottom edges
+
+/* Golden Frames */
+#define GOLDEN_REPLAY 0                                 // 1: replay a fixed seed and check chosen frames instead of the game
+#define GOLDEN_CAPTURE 0                                // 1: store the chosen frames as golden, 0: compare against the stored ones
+#define GOLDEN_DUMP 0                                   // 1: also send every chosen frame as a PPM over the JTAG UART
+#define GOLDEN_SEED 2021
+#define GOLDEN_CHECK_NUM 6
+#define GOLDEN_FRAME_SIZE (RESOLUTION_X * RESOLUTION_Y)               // Pixels of one stored frame
+#define GOLDEN_STORE_BASE (SDRAM_BASE + 0x01000000)     // Far from the frame buffers, kept across program loads
+
 /* ************************************************** Global Area ***************************************************** */
 #include <time.h>
 #include <math.h>
@@ -92,6 +270,20 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#if HEADLESS_SERVER
+#include <pthread.h>
+#include <unistd.h>
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL
+#endif
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
     
 /* Type Definition of Balls */
 typedef struct ourBall{
@@ -106,23 +298,206 @@ typedef struct ourBall{
     
     int lastXLocation;
     int lastYLocation;
+    
+    int xFraction;   // Sub-pixel part of the location, 0 to FIXED_ONE - 1
+    int yFraction;
 } Ball;
 
+/* Type Definition of Live Lists */
+// Live entities packed at the front of index[], so that loops never meet a dead slot
+typedef struct liveList{
+    int num;                        // Live entities
+    int index[LIVE_MAX];            // Entity index of every live entity
+    int slot[LIVE_MAX];             // Where an entity sits in index[]
+    unsigned int alive[LIVE_WORDS]; // One bit per entity
+} LiveList;
+
+/* Type Definition of Circle Sets */
+// Centres of the live food as plain arrays, in live list order, for the proximity kernel
+typedef struct circleSet{
+    int num;
+    short int xy[2 * CIRCLE_SET_MAX];   // Entry j at 2j and 2j + 1, the playfield fits in 16 bits
+} CircleSet;
+
+/* Type Definition of Arenas */
+// Linear allocator: allocation moves used forward, reset and release move it back
+typedef struct arena{
+    const char *name;
+    unsigned char *memory;
+    int size;
+    int used;
+    int highWater;              // Most bytes ever in use
+} Arena;
+
+/* Type Definition of Eat Events */
+// One collision found by detection, applied later by resolve_eat_events
+typedef struct eatEvent{
+    char eaterKind;  // ENTITY_*
+    char victimKind;
+    short eater;     // Index into AI or food, 0 for the player
+    short victim;
+} EatEvent;
+
+/* 16.16 Fixed Point Number */
+typedef int fixed;
+
+/* Type Definition of Draw Commands */
+typedef struct drawCommand{
+    char type;
+    short int color;
+    
+    int xLocation;              // Centre of circle, top left corner of rect and sprite
+    int yLocation;
+    int width;                  // Radius of circle
+    int height;
+    
+    const uint16_t *sprite;     // Sprite pixels row by row
+    const short int *spans;     // Circle half width of each row, top to bottom
+    bool hidden;                // Covered by a circle drawn later, never binned
+    
+    int first;                  // Points of a point run: points[first] to points[first + count - 1]
+    int count;
+} DrawCommand;
+
+/* Type Definition of Render Bands */
+// Rows the rasterizer is working on and its scratch tile
+typedef struct renderBand{
+    int firstRow;                                   // Tile rows firstRow to lastRow - 1
+    int lastRow;
+    short int tileBuffer[TILE_SIZE * TILE_SIZE];    // One tile, rasterized before the burst write
+} RenderBand;
+
+/* Type Definition of Points */
+typedef struct point{
+    short int xLocation;
+    short int yLocation;
+    short int color;
+    short int radius;
+    bool hidden;                // Covered by a circle drawn later, never binned
+} Point;
+
+/* Type Definition of Span Cache Entries */
+// Half widths of one radius, kept across frames
+typedef struct spanEntry{
+    int radius;
+    int offset;                 // First half width in spanCache
+    unsigned int lastUsed;      // Frame stamp of the last use
+} SpanEntry;
+
+/* Type Definition of Audio Voices */
+typedef struct audioVoice{
+    bool active;
+    bool loop;
+    
+    const short int *table;     // Wavetable played by the voice
+    int length;                 // Samples in the wavetable
+    unsigned int phase;         // 16.16 position in the wavetable
+    unsigned int step;          // 16.16 position change per output sample
+    int volume;                 // 0 - 256
+} Voice;
+
+/* Type Definition of Game World */
+// Everything one round needs, so that many rounds can exist at once
+typedef struct gameWorld{
+    Ball player;                // Ball of Player
+    Ball AI[AI_NUM];            // Ball Array of AI
+    Ball food[FOOD_NUM];        // Ball Array of Food
+    LiveList liveAI;            // AI Balls not eaten
+    LiveList liveFood;          // Foods not eaten
+    short int AITarget[AI_NUM]; // AI each AI is chasing, -1 if none
+    
+    bool endGame;
+    bool pauseGame;
+    unsigned int frameCount;
+    unsigned int randomSeed;    // State of game_rand
+    int keys;                   // ARROW_* bits steering the player
+    int sounds;                 // 1 << SFX_* of the eats this tick, played and cleared by the board
+    
+    short int influenceFood[INFLUENCE_ROWS][INFLUENCE_COLS];   // Food density spread over the grid
+    short int influenceThreat[INFLUENCE_ROWS][INFLUENCE_COLS]; // Largest ball radius covering the cell
+    short int influenceTarget[INFLUENCE_ROWS][INFLUENCE_COLS]; // One food inside the cell, -1 if none
+} World;
+
+#if HEADLESS_SERVER
+/* Type Definition of Server Work Deques */
+// Worlds waiting for a server worker, a ring of world indices.
+// The owner pushes and pops at the bottom, other workers steal from the top
+typedef struct workDeque{
+    pthread_mutex_t lock;
+    int top;                    // Next world a thief takes
+    int bottom;                 // One past the world the owner takes next
+    int world[SESSION_NUM];     // Indexed modulo SESSION_NUM, a world is in one deque at most
+} WorkDeque;
+#endif
+
+/* Type Definition of Batch Environment */
+// Food and AIs are interleaved across worlds, entry [k][w] is food k of world w,
+// so that every eat predicate runs over all worlds in a vectorizable loop
+typedef struct batchEnv{
+    int num;
+    World worlds[BATCH_MAX];
+    
+    int foodX[FOOD_NUM][BATCH_MAX];
+    int foodY[FOOD_NUM][BATCH_MAX];
+    int foodAlive[FOOD_NUM][BATCH_MAX];
+    int AIX[AI_NUM][BATCH_MAX];
+    int AIY[AI_NUM][BATCH_MAX];
+    int AIRadius[AI_NUM][BATCH_MAX];
+    int AIRadiusThird[AI_NUM][BATCH_MAX];   // Kept divided so the pair loop vectorizes without SSE4.1
+    
+    // Outputs of batch_player_eat_food and batch_AI_eat, one bit per victim like LiveList.alive
+    // AIEatsAI is one byte per pair, bits from a loop this short get jammed and the vectorizer gives up
+    unsigned int playerEatsFood[LIVE_WORDS][BATCH_MAX];
+    unsigned int AIEatsFood[AI_NUM][LIVE_WORDS][BATCH_MAX];
+    unsigned char AIEatsAI[AI_NUM][AI_NUM][BATCH_MAX];
+    unsigned int playerEatsAI[LIVE_WORDS][BATCH_MAX];
+    unsigned int AIEatsPlayer[LIVE_WORDS][BATCH_MAX];
+} BatchEnv;
+
+/* Type Definition of Observations */
+typedef struct observation{
+    short int playerX;
+    short int playerY;
+    short int playerRadius;
+    
+    short int AIX[AI_NUM];
+    short int AIY[AI_NUM];
+    short int AIRadius[AI_NUM];             // 0 when eaten
+} Observation;
+
+/* Type Definition of World Snapshot */
+// What the renderer draws, taken once the simulation of a frame is done
+// Only live balls are copied, packed at the front
+typedef struct worldSnapshot{
+    Ball player;
+    Ball AI[AI_NUM];
+    Ball food[FOOD_NUM];
+    int AINum;
+    int foodNum;
+} Snapshot;
+
 /* Function Prototypes */
 void wait_for_vsync();
+void request_swap();
+bool swap_pending();
+void present_frame();
+void acquire_back_buffer();
+void service_present_queue();
+void reset_present_queue();
+void finish_presenting();
+void simulate_frame();
+void take_snapshot(World *);
 
 void initial_game();
 void initial_memory_base();
-void initial_player();
-void initial_AI();
-void initial_food();
-void initial_score();
+void initial_player(World *);
+void initial_AI(World *);
+void initial_food(World *);
+void initial_score(World *);
 
 void keyboard_input();
-void up_input();
-void right_input();
-void left_input();
-void down_input();
+void key_event(char, bool, bool);
+void player_move(World *);
 void start_input();
 void pause_input();
 
@@ -131,59 +506,295 @@ void plot_food();
 void plot_AI();
 void plot_player();
 void clear_screen();
-void menu_screen();
 void plot_pixel(int, int, short int);
 void plot_circle(Ball);
 void draw_line(int, int, int, int, short int);
 
+void begin_frame(short int);
+void submit_circle(int, int, int, short int);
+void submit_rect(int, int, int, int, short int);
+void submit_sprite(const uint16_t *, int, int, int, int);
+void bin_command(int, int, int, int, int);
+void bin_commands();
+void submit_point(int, int, int, short int);
+void bin_point_run(int);
+void bin_points();
+bool point_tiles(Point *, int *, int *, int *, int *);
+void rasterize_points(RenderBand *, DrawCommand *, int, int, int, int, int *, int);
+void cull_hidden_circles();
+bool circle_covers(DrawCommand *, int, int, int, const short int *);
+void circle_spans(int, short int *);
+int span_cache_lookup(int);
+bool span_cache_evict();
+void render_frame();
+void render_band(RenderBand *, int, bool);
+void rasterize_tile(RenderBand *, int, int);
+void fill_span(RenderBand *, int, int, short int);
+void invalidate_tiles();
+int frame_buffer_index();
+
 void video_text(int, int, char *);
 void cleartext();
 void display_score();
-void update_score();
+void update_score(World *);
+void display_hex();
+void update_fps();
 void display_menutext();
-void draw_pic_a();
-void draw_pic_b();
-void draw_pic_c();
-void draw_pic_e();
 void display_pausetext();
 void display_endingtext();
 
-void update_game();
-void AI_update();
-void AIChase(Ball *, Ball *);
+void update_game(World *);
+void AI_update(World *);
+void AIChase(World *, Ball *, Ball *);
+bool AICanMove(World *, Ball *);
+void move_ball(Ball *, fixed, fixed);
+void initial_speed_table();
+int speed_index(int);
+
+void build_influence_map(World *);
+void AISteer(World *, Ball *);
+int influence_score(World *, Ball *, int, int);
 
-void game_react();
-void playerEatFood();
-void AIEatFood();
-void playerEatAI();
+void game_react(World *);
+void live_reset(LiveList *);
+void live_insert(LiveList *, int);
+void live_remove(LiveList *, int);
+int live_copy(LiveList *, Ball *, Ball *);
+void kill_food(World *, int);
+void kill_AI(World *, int);
+void queue_eat_event(int, int, int, int);
+void resolve_eat_events(World *);
+Ball *entity_ball(World *, int, int);
+int begin_eat_events(World *);
+void end_eat_events(World *, int);
+void *arena_alloc(Arena *, int);
+void arena_reset(Arena *);
+int arena_mark(Arena *);
+void arena_release(Arena *, int);
+void arena_report(Arena *);
+void present_report();
+void initial_round_memory();
+void initial_thread_memory();
+void build_circle_set(CircleSet *, LiveList *, Ball *);
+int circle_query(const CircleSet *, int, int, int, unsigned char *);
+int pair_distance(World *, int, int);
+int track_target(World *, int);
+int find_target(World *, int, int *);
+int target_distance(World *, int, int);
+void invalidate_pairs(int);
+bool within_reach(int, int);
+void detect_scheduled_eats(World *);
+void refresh_schedule(World *);
+void schedule_pair(World *, int, unsigned int);
+int test_pair(World *, int);
+int mover_speed(World *, int);
+Ball *mover_ball(World *, int);
+void schedule_link(int, unsigned int);
+void schedule_unlink(int);
+void respawn_food(World *);
+void respawn_AI(World *);
+void playerEatFood(World *);
 
 void opening();
 void ending();
 
-float findDistance(Ball, Ball);
-float findDistanceForPlayer(Ball, int, int);
-bool overlapPlayer(Ball);
-bool overlapAI(Ball);
+void audio_init();
+void audio_update();
+void audio_mix();
+void audio_play_sfx(int);
+void music_next_note();
+
+void reset_world(World *, unsigned int);
+void step_world(World *);
+#if HEADLESS_SERVER
+void run_sessions(World *, int, int);
+void *session_worker(void *);
+void deque_push(WorkDeque *, int);
+int deque_pop(WorkDeque *);
+int deque_steal(WorkDeque *);
+#endif
+void start_timer();
+unsigned int read_timer();
+void jtag_print(char *);
+void run_golden_replay();
+void build_crc_table();
+unsigned int frame_crc();
+void capture_frame(int);
+void compare_frame(int, int);
+void dump_frame_ppm(int);
+void jtag_put(char);
+
+void batch_reset(BatchEnv *, int, unsigned int);
+void batch_step(BatchEnv *, const int *, Observation *, int *, bool *);
+void batch_player_eat_food(BatchEnv *);
+void batch_AI_eat(BatchEnv *);
+void batch_queue_eats(BatchEnv *, int);
+bool batch_bit(unsigned int [LIVE_WORDS][BATCH_MAX], int, int);
+bool batch_any(unsigned int [LIVE_WORDS][BATCH_MAX], int);
+void batch_scatter(BatchEnv *, int);
+void batch_input(World *, int);
+void batch_observe(World *, Observation *);
+
+int save_snapshot(World *, unsigned char *, int);
+bool restore_snapshot(World *, const unsigned char *, int);
+bool save_snapshot_file(World *, const char *);
+bool restore_snapshot_file(World *, const char *);
+void write_ball(unsigned char **, Ball *);
+bool read_ball(const unsigned char **, Ball *, int);
+bool on_playfield(int, int);
+bool palette_color(int);
+unsigned int snapshot_crc(const unsigned char *, int);
+void write_live(unsigned char **, LiveList *, int);
+bool read_live(const unsigned char **, LiveList *, Ball *, int);
+void write_u16(unsigned char **, int);
+void write_u32(unsigned char **, unsigned int);
+int read_s16(const unsigned char **);
+unsigned int read_u32(const unsigned char **);
+int game_rand(World *);
+void game_srand(World *, unsigned int);
+
+bool overlapPlayer(World *, Ball);
+bool overlapAI(World *, Ball);
+int int_sqrt(int);
 void swap(int*, int*);
 
 
 /* Global Variables */
-Ball player;         // Ball of Player
-Ball AI[AI_NUM];     // Ball Array of AI
-Ball food[FOOD_NUM]; // Ball Array of Food
+World game;          // World played on the board
+
+// Nothing below is taken from the heap
+// Scratch of the simulation is per thread, so that the server workers each step their own world
+THREAD_LOCAL unsigned char frameArenaMemory[FRAME_ARENA_SIZE];
+THREAD_LOCAL unsigned char roundArenaMemory[ROUND_ARENA_SIZE];
+THREAD_LOCAL Arena frameArena = {"frame", NULL, FRAME_ARENA_SIZE, 0, 0}; // Reset by begin_frame
+THREAD_LOCAL Arena roundArena = {"round", NULL, ROUND_ARENA_SIZE, 0, 0}; // Reset when a round starts
+
+THREAD_LOCAL EatEvent *eatEvents;               // Collisions of this frame in detection order, in the frame arena
+THREAD_LOCAL int eatEventNum = 0;
+
+THREAD_LOCAL CircleSet *foodSet;                // Live food, rebuilt before detection, in the round arena
+
+// Squared distances between AIs and the player, valid while the stamp equals pairFrame
+THREAD_LOCAL int pairDistance[PAIR_SLOTS][PAIR_SLOTS];
+THREAD_LOCAL unsigned int pairStamp[PAIR_SLOTS][PAIR_SLOTS];
+THREAD_LOCAL unsigned int pairFrame = 1;        // Moves on at every detection pass, 0 marks a dropped pair
+
+// Pairs are only tested from the frame they could first touch, assuming no ball outruns its speed.
+// One list of pairs per frame of the horizon, linked through pairNext and pairPrev in the round arena
+THREAD_LOCAL int scheduleBucket[SCHEDULE_HORIZON];
+THREAD_LOCAL int *pairNext;
+THREAD_LOCAL int *pairPrev;
+THREAD_LOCAL unsigned int *pairDue;             // Frame each pair is tested next, SCHEDULE_NEVER if in no list
+THREAD_LOCAL unsigned int scheduleFrame;        // Last frame whose list was tested
+THREAD_LOCAL Ball scheduleSeen[PAIR_SLOTS];     // Movers as the last detection saw them
+THREAD_LOCAL bool moverTouched[PAIR_SLOTS];     // Movers whose pairs are scheduled again before the next detection
+THREAD_LOCAL bool foodTouched[FOOD_NUM];
+THREAD_LOCAL bool scheduleStale = true;         // Every pair is scheduled again, set when the world is replaced
+THREAD_LOCAL World *scheduleWorld = NULL;       // World the schedule belongs to
 
-bool endGame = false;
-bool pauseGame = false;
 bool startGame = false;
 bool restartGame = false;
 
+fixed playerSpeed[SPEED_TABLE_SIZE];  // Player step per tick by radius
+fixed playerDiagonalSpeed[SPEED_TABLE_SIZE];  // Same along each axis when moving diagonally
+fixed AISpeed[SPEED_TABLE_SIZE];      // AI step per move by radius, 21 / radius but at least one pixel
+
+Snapshot frameSnapshot;  // World as it is drawn in the back buffer
+
+short int sineTable[SINE_TABLE_SIZE];
+short int sfxEat[SFX_EAT_SAMPLES];       // Short rising chirp
+short int sfxGulp[SFX_GULP_SAMPLES];     // Longer falling tone
+Voice voices[AUDIO_VOICE_NUM];
+short int audioRing[AUDIO_RING_SIZE];
+unsigned int audioRingHead = 0;          // Next sample to mix
+unsigned int audioRingTail = 0;          // Next sample to send to the codec
+int musicNote = 0;
+int musicSamplesLeft = 0;
+
+// Background melody in Hz, 0 is a rest
+const short int melody[16] = {262, 330, 392, 523, 392, 330, 262, 0, 294, 349, 440, 587, 440, 349, 294, 0};
+
+int displayedBuffer = 0;     // Buffer scanned out by the VGA controller
+int pendingBuffer = -1;      // Buffer waiting for the vertical sync, -1 if none
+int queuedBuffer = -1;       // Finished frame waiting for the pending swap, -1 if none
+unsigned int framesPresented = 0;
+unsigned int framesDropped = 0;
+
+DrawCommand *drawCommands;                             // Draw list of the current frame, in the frame arena
+int drawCommandNum = 0;
+short int spanCache[SPAN_CACHE_SIZE];                  // Half widths of every cached radius, packed in entry order
+int spanCacheUsed = 0;
+SpanEntry spanEntries[SPAN_CACHE_ENTRIES];             // Oldest allocation first
+int spanEntryNum = 0;
+short int spanEntryOf[SPAN_CACHE_MAX_RADIUS + 1];      // Entry + 1 of each radius, 0 if not cached
+unsigned int spanCacheFrame = 0;                       // Frame stamp, entries used in this frame are not evicted
+unsigned int spanCacheHits = 0;
+unsigned int spanCacheMisses = 0;
+short int frameBackground = BLACK;
+
+short int tileBin[TILE_ROWS][TILE_COLS][MAX_DRAW_COMMANDS]; // Commands touching each tile, in draw order
+short int tileBinNum[TILE_ROWS][TILE_COLS];
+RenderBand currentBand;                                     // Band being rasterized, bands are drawn in turn
+
+
+Point points[MAX_POINTS];                                   // Tiny circles of the current frame
+int pointNum = 0;
+short int tilePointStart[TILE_ROWS][TILE_COLS];             // First entry of each tile in tilePoints
+short int tilePointNum[TILE_ROWS][TILE_COLS];
+short int tilePoints[MAX_POINTS * 4];                       // Points touching each tile, a point touches 4 tiles at most
+
+// Half widths of the tiny circles, same rows as circle_spans
+const short int pointSpans[POINT_MAX_RADIUS + 1][2*POINT_MAX_RADIUS + 1] = {
+    {0, 0, 0, 0, 0},
+    {0, 1, 0, 0, 0},
+    {1, 2, 2, 2, 1}
+};
+
+#if TRIPLE_BUFFERING
+int frameBuffers[FRAME_BUFFER_NUM] = {FPGA_ONCHIP_BASE, SDRAM_BASE, THIRD_BUFFER_BASE};
+#else
+int frameBuffers[FRAME_BUFFER_NUM] = {FPGA_ONCHIP_BASE, SDRAM_BASE};
+#endif
+bool tileDirty[FRAME_BUFFER_NUM][TILE_ROWS][TILE_COLS];    // Tile was drawn the last time this buffer was used
+short int bufferBackground[FRAME_BUFFER_NUM];
+
 short int color[9] = {RED, YELLOW, GREEN, BLUE, CYAN, MAGENTA, GREY, PINK, ORANGE};
-char byte1 = 0, byte2 = 0, byte3 = 0;
+int keyState = 0;            // ARROW_* bits of the arrow keys held down
+bool extendedKey = false;    // E0 prefix seen
+bool releaseKey = false;     // F0 prefix seen
 
 volatile int pixel_buffer_start;
 volatile int * PS2_ptr = (int *)PS2_BASE;
 volatile int * pixel_ctrl_ptr = (int *)PIXEL_BUF_CTRL_BASE;
 volatile int * audio_ptr = (int*)AUDIO_BASE;
+volatile int * timer_ptr = (int*)MPCORE_PRIV_TIMER;
+volatile int * jtag_ptr = (int*)JTAG_UART_BASE;
+volatile int * hex3_0_ptr = (int*)HEX3_HEX0_BASE;
+volatile int * hex5_4_ptr = (int*)HEX5_HEX4_BASE;
+volatile int * sw_ptr = (int*)SW_BASE;
+
+// Segments a to g of the digits 0 to 9
+const unsigned char hexSegments[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+int hexValue = -1;           // Number on the displays now, -1 forces a write
+int textScore = -1;          // Score in the text buffer now, -1 forces a write
+unsigned int fpsMark = 0;    // Timer value when the current second started
+unsigned int fpsFrames = 0;  // framesPresented when the current second started
+int framesPerSecond = 0;
+
+#if HEADLESS_SERVER
+World sessions[SESSION_NUM];
+World *serverWorlds;                              // Worlds of the current server run
+int serverThreadNum;
+int sessionTicksLeft[SESSION_NUM];                // Ticks each world still runs in this server run
+WorkDeque serverDeques[SERVER_THREADS_MAX];       // One per worker
+pthread_t serverThreads[SERVER_THREADS_MAX];
+unsigned int serverRounds[SERVER_THREADS_MAX];    // Rounds finished by each worker
+#endif
+
+// Frames checked by the golden replay, and the keys held along the way
+const int goldenFrames[GOLDEN_CHECK_NUM] = {0, 1, 60, 300, 1000, 3000};
+const int goldenKeys[8] = {ARROW_RIGHT, ARROW_RIGHT | ARROW_DOWN, ARROW_DOWN, 0, ARROW_LEFT, ARROW_LEFT | ARROW_UP, ARROW_UP, ARROW_RIGHT | ARROW_UP};
+unsigned int crcTable[256];
 
 const uint16_t battle_of_balls[150][276] = {
     {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61340,50869,40333,44560,59258,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
@@ -477,6 +1088,21 @@ const uint16_t gameIsOver[66][200] = {
 // Main Function
 int main(){
     
+    // Arenas of the board thread
+    initial_thread_memory();
+    
+#if GOLDEN_REPLAY
+    // Render a fixed replay and report every checked frame on the JTAG UART
+    run_golden_replay();
+    while(true);
+#endif
+    
+#if HEADLESS_SERVER
+    // One run on a Linux host, reported on stdout
+    run_sessions(sessions, SESSION_NUM, SESSION_TICKS);
+    return 0;
+#endif
+    
     while(true){
         // Initialise Memory Base
         initial_memory_base();
@@ -486,19 +1112,16 @@ int main(){
             
             //display_menutext();
             
-            // Ending Menu
-            menu_screen();
+            // Start Menu
+            begin_frame(WHITE);
+            submit_sprite(&battle_of_balls[0][0], 22, 18, 276, 150);
+            submit_sprite(&note[0][0], 96, 200, 128, 15);
+            submit_sprite(&start[0][0], 60, 170, 200, 20);
+            render_frame();
             
-            draw_pic_a(150,276,battle_of_balls[150][276],22,18);
-            draw_pic_b(15,128,note[15][128],96,200);
-            draw_pic_c(20,200,start[20][200],60,170);
-            //draw_pic_d(20,20,pause[20][20],150,80);
             wait_for_vsync(); // swap front and back buffers on VGA vertical sync
             pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
             
-            // Erase any boxes and lines that were drawn in the last iteration
-            clear_screen();
-            
             // code for keyboard input
             keyboard_input();
         }
@@ -512,67 +1135,67 @@ int main(){
             // code for keyboard input
             keyboard_input();
             
+            // First frame is simulated before anything is drawn
+            simulate_frame();
+            take_snapshot(&game);
+            reset_present_queue();
+            
             // Start one round Game
             // Game won't stop until player is eaten
-            while(!endGame){
-                // Erase any boxes and lines that were drawn in the last iteration
-                clear_screen();
-            
-                // Balls Eating each other
-                game_react();
-            
-                // code for drawing the boxes and lines (not shown)
+            while(!game.endGame){
+                // Draw the snapshot of frame N, background included
                 plot_game();
-            
-                // code for keyboard input
-                keyboard_input();
-            
-                // code for updating the locations of boxes (not shown)
-                update_game();
                     
                 // code for text display
                 display_score();
-            
-                wait_for_vsync(); // swap front and back buffers on VGA vertical sync
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
+                
+                // show frame N on the next VGA vertical sync
+                present_frame();
+                
+                // Frame N+1 is simulated while the swap of frame N is pending
+                simulate_frame();
+                take_snapshot(&game);
+                
+                // new back buffer
+                acquire_back_buffer();
                 
                 // Press [Space] to Puase Game
                 // Press [Enter] to Resume Game
-                while(pauseGame){
+                while(game.pauseGame){
                     // code for keyboard input
                     cleartext();
-                    while(pauseGame){
+                    while(game.pauseGame){
                         display_pausetext();
                         keyboard_input();
+                        audio_update();
                     }
                     cleartext();
                 }
                 
-                // Player win the Game
-                if(player.radius >= RESOLUTION_Y/2)
-                    endGame = true;
-                
             }// One Round Game Finished
             
+            // Menus go back to plain double buffering
+            finish_presenting();
+            
+            // How close the arenas came to their size this round, and how many frames made it to the screen
+            arena_report(&frameArena);
+            arena_report(&roundArena);
+            present_report();
+            
             restartGame = false;
             
             // Press [Enter] to Restart
             while(!restartGame){
                 // Ending Menu
-                menu_screen();
-                draw_pic_e(66,200,gameIsOver[66][200],60,90);
-                for(int x=0;x<320;x++){
-                    for(int y=196;y<208;y++){
-                        plot_pixel(x,y,BLACK);
-                    }
-                }
+                begin_frame(WHITE);
+                submit_sprite(&gameIsOver[0][0], 60, 90, 200, 66);
+                submit_rect(0, 196, RESOLUTION_X, 12, BLACK);
+                render_frame();
+                
                 display_endingtext();
                 wait_for_vsync(); // swap front and back buffers on VGA vertical sync
                 pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
                 
-                // Erase any boxes and lines that were drawn in the last iteration
-                clear_screen();
-                
                 // code for keyboard input
                 keyboard_input();
             }
@@ -587,45 +1210,69 @@ int main(){
 
 // Function 1: Wait for screen to be syncronised
 void wait_for_vsync(){
-    volatile int *pixel_ctrl_ptr = (int *) PIXEL_BUF_CTRL_BASE;
-    register int status;
+    request_swap();
     
+    // Keep the codec fed while waiting
+    while(swap_pending())
+        audio_update();
+}
+
+// Function 50: Ask for a buffer swap on the next vertical sync, without waiting
+void request_swap(){
     *pixel_ctrl_ptr = 1;
-    
-    status = *(pixel_ctrl_ptr + 3);
-    
-    while((status & 0x01) != 0){
-        status = *(pixel_ctrl_ptr + 3);
-    }
+}
+
+// Function 51: Swap is still waiting for the vertical sync
+bool swap_pending(){
+    return (*(pixel_ctrl_ptr + 3) & 0x01) != 0;
 }
 
 /* ******************************************* Initial Game Functions Area ******************************************** */
 
 // Function 2: Initialise Game Randomly
 void initial_game(){
-    // FIFO is Empty
-    byte1 = 0, byte2 = 0, byte3 = 0;
+    // No key is held
+    keyState = 0;
+    extendedKey = false;
+    releaseKey = false;
     
     // Game Not End
-    endGame = false;
+    game.endGame = false;
+    
+    // Influence map is rebuilt on the first update
+    game.frameCount = 0;
     
     // Random generate seed
-    srand((unsigned)time(NULL));
+    game_srand(&game, (unsigned)time(NULL));
+    
+    initial_round_memory();
     
-    initial_player();
+    initial_speed_table();
     
-    initial_AI();
+    initial_player(&game);
     
-    initial_food();
+    initial_AI(&game);
     
-    initial_score();
+    initial_food(&game);
+    
+    initial_score(&game);
     
     // Opening Animation
     opening();
+    
+    // Opening draws without the tile renderer
+    invalidate_tiles();
 }
 
 // Function 3:
 void initial_memory_base(){
+    // Music starts with the menu
+    audio_init();
+    
+    // Timer measures frames per second for the seven segment readout
+    start_timer();
+    fpsMark = read_timer();
+    
     /* set front pixel buffer to start of FPGA On-chip memory */
     // first store the address in the back buffer
     *(pixel_ctrl_ptr + 1) = FPGA_ONCHIP_BASE;
@@ -639,6 +1286,9 @@ void initial_memory_base(){
     // pixel_buffer_start points to the pixel buffer
     clear_screen();
     
+    // Nothing is known about what the buffers hold
+    invalidate_tiles();
+    
     /* set back pixel buffer to start of SDRAM memory */
     *(pixel_ctrl_ptr + 1) = SDRAM_BASE;
     
@@ -650,219 +1300,200 @@ void initial_memory_base(){
 }
 
 // Function 4: Random Generate Player Location
-void initial_player(){
+void initial_player(World *world){
     // Initialise Player's Information
-    player.color = WHITE;
-    player.radius = 5;
-    player.isEaten = false;
+    world->player.color = WHITE;
+    world->player.radius = 5;
+    world->player.isEaten = false;
     
     // Initialise Player's Location
-    player.xLocation = RESOLUTION_X/2;
-    player.yLocation = RESOLUTION_Y/2;
-    player.lastXLocation = RESOLUTION_X/2;
-    player.lastYLocation = RESOLUTION_Y/2;
+    world->player.xLocation = RESOLUTION_X/2;
+    world->player.yLocation = RESOLUTION_Y/2;
+    world->player.lastXLocation = RESOLUTION_X/2;
+    world->player.lastYLocation = RESOLUTION_Y/2;
+    world->player.xFraction = 0;
+    world->player.yFraction = 0;
 }
 
 // Function 5: Random Generate AI Balls
-void initial_AI(){
+void initial_AI(World *world){
+    live_reset(&world->liveAI);
+    
     for (int i = 0; i < AI_NUM; i++){
-        AI[i].color = color[rand()%9];
-        AI[i].isEaten = false;
-        AI[i].radius = (int)(rand() % 10 + 3);
+        world->AI[i].color = color[game_rand(world)%9];
+        world->AI[i].isEaten = false;
+        world->AI[i].radius = (int)(game_rand(world) % 10 + 3);
+        world->AITarget[i] = -1;
+        world->AI[i].xFraction = 0;
+        world->AI[i].yFraction = 0;
         
-        AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-        AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
+        world->AI[i].xLocation = game_rand(world) % (RESOLUTION_X - world->AI[i].radius) + world->AI[i].radius;
+        world->AI[i].yLocation = game_rand(world) % (RESOLUTION_Y - world->AI[i].radius) + world->AI[i].radius;
         
         // AI Balls won't over the boarder
-        while(overlapPlayer(AI[i])){
-            AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-            AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
+        for(int tries = 1; overlapPlayer(world, world->AI[i]) && tries < SPAWN_TRIES; tries++){
+            world->AI[i].xLocation = game_rand(world) % (RESOLUTION_X - world->AI[i].radius) + world->AI[i].radius;
+            world->AI[i].yLocation = game_rand(world) % (RESOLUTION_Y - world->AI[i].radius) + world->AI[i].radius;
         }
+        
+        live_insert(&world->liveAI, i);
     }
 }
 
 // Function 6: Random Generate Foods
-void initial_food(){
+void initial_food(World *world){
+    live_reset(&world->liveFood);
+    
     for (int i = 0; i < FOOD_NUM; i++){
-        food[i].radius = 1;
-        food[i].color = color[rand()%9];
-        food[i].isEaten = false;
+        world->food[i].radius = 1;
+        world->food[i].color = color[game_rand(world)%9];
+        world->food[i].isEaten = false;
+        world->food[i].xFraction = 0;
+        world->food[i].yFraction = 0;
         
-        food[i].xLocation = (int)(rand() % RESOLUTION_X);
-        food[i].yLocation = (int)(rand() % RESOLUTION_Y);
+        world->food[i].xLocation = (int)(game_rand(world) % RESOLUTION_X);
+        world->food[i].yLocation = (int)(game_rand(world) % RESOLUTION_Y);
         
-        while(overlapPlayer(food[i])){
-            food[i].xLocation = (int)(rand() % RESOLUTION_X);
-            food[i].yLocation = (int)(rand() % RESOLUTION_Y);
+        for(int tries = 1; overlapPlayer(world, world->food[i]) && tries < SPAWN_TRIES; tries++){
+            world->food[i].xLocation = (int)(game_rand(world) % RESOLUTION_X);
+            world->food[i].yLocation = (int)(game_rand(world) % RESOLUTION_Y);
         }
+        
+        live_insert(&world->liveFood, i);
     }
 }
 
 // Function 7: Initailise score as 100
-void initial_score(){
-    player.score=0;
+void initial_score(World *world){
+    world->player.score=0;
 }
 
 /* ***************************************** Keyboard Input Functions Area ******************************************** */
 
 // Function 8: PS/2 Port Input Main Function
+// Drains the FIFO and keeps track of which arrow keys are held
 void keyboard_input(){
     int PS2_Data = *(PS2_ptr);
-    int ReadValid = PS2_Data & 0x8000;
     
-    if(ReadValid){
-        byte1 = byte2;
-        byte2 = byte3;
-        byte3 = PS2_Data & 0xFF;
-        
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x75))
-            up_input();
-        
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x74))
-            right_input();
-        
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x6B))
-            left_input();
+    while(PS2_Data & 0x8000){
+        char code = PS2_Data & 0xFF;
         
-        if((byte1 == (char)0xE0) && (byte2 == (char)0xF0) && (byte3 == (char)0x72))
-            down_input();
-        
-        if((byte1 == (char)0x5A) && (byte2 == (char)0xF0) && (byte3 == (char)0x5A))
-            start_input();
+        if(code == (char)0xE0){
+            extendedKey = true;
+        }else if(code == (char)0xF0){
+            releaseKey = true;
+        }else{
+            key_event(code, extendedKey, releaseKey);
+            extendedKey = false;
+            releaseKey = false;
+        }
         
-        if((byte1 == (char)0x29) && (byte2 == (char)0xF0) && (byte3 == (char)0x29))
-            pause_input();
+        PS2_Data = *(PS2_ptr);
     }
 }
 
-// Function 8: Press [Direction] Button to Move Balls
-void up_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 40) speed = 6;
-    if(player.radius > 80) speed = 4;
-    if(player.radius > 120) speed = 2;
+// Function 85: One complete key press or release
+void key_event(char code, bool extended, bool release){
+    int arrow = 0;
     
-    if(player.yLocation - player.radius > 0){
-        player.lastYLocation = player.yLocation;
-        player.yLocation -= speed;
+    if(extended){
+        if(code == (char)0x75) arrow = ARROW_UP;
+        if(code == (char)0x74) arrow = ARROW_RIGHT;
+        if(code == (char)0x6B) arrow = ARROW_LEFT;
+        if(code == (char)0x72) arrow = ARROW_DOWN;
     }
-}
-
-void right_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 40) speed = 6;
-    if(player.radius > 80) speed = 4;
-    if(player.radius > 120) speed = 2;
     
-    if(player.xLocation + player.radius < RESOLUTION_X){
-        player.lastXLocation = player.xLocation;
-        player.xLocation += speed;
+    if(arrow){
+        if(release)
+            keyState &= ~arrow;
+        else
+            keyState |= arrow;
+        return;
     }
-}
-
-void left_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 40) speed = 6;
-    if(player.radius > 80) speed = 4;
-    if(player.radius > 120) speed = 2;
     
-    if(player.xLocation - player.radius > 0){
-        player.lastXLocation = player.xLocation;
-        player.xLocation -= speed;
-    }
+    if(release && code == (char)0x5A)
+        start_input();
+    
+    if(release && code == (char)0x29)
+        pause_input();
 }
 
-void down_input(){
-    double speed = 80/(player.radius);
-    if(player.radius > 10) speed = 8;
-    if(player.radius > 40) speed = 6;
-    if(player.radius > 80) speed = 4;
-    if(player.radius > 120) speed = 2;
+// Function 86: Move the Player every tick along the held arrow keys
+void player_move(World *world){
+    int dx = ((world->keys & ARROW_RIGHT) != 0) - ((world->keys & ARROW_LEFT) != 0);
+    int dy = ((world->keys & ARROW_DOWN) != 0) - ((world->keys & ARROW_UP) != 0);
+    
+    int index = speed_index(world->player.radius);
+    fixed speed = (dx != 0 && dy != 0) ? playerDiagonalSpeed[index] : playerSpeed[index];
+    
+    // Last location is where the player was before it last moved on that axis
+    if(dx != 0) world->player.lastXLocation = world->player.xLocation;
+    if(dy != 0) world->player.lastYLocation = world->player.yLocation;
+    
+    move_ball(&world->player, dx * speed, dy * speed);
     
-    if(player.yLocation + player.radius < RESOLUTION_Y){
-        player.lastYLocation = player.yLocation;
-        player.yLocation += speed;
+    // Player won't over the boarder, a clamped axis also drops its sub-pixel part
+    if(world->player.xLocation - world->player.radius < 0){
+        world->player.xLocation = world->player.radius;
+        world->player.xFraction = 0;
     }
+    if(world->player.yLocation - world->player.radius < 0){
+        world->player.yLocation = world->player.radius;
+        world->player.yFraction = 0;
+    }
+    if(world->player.xLocation + world->player.radius > RESOLUTION_X){
+        world->player.xLocation = RESOLUTION_X - world->player.radius;
+        world->player.xFraction = 0;
+    }
+    if(world->player.yLocation + world->player.radius > RESOLUTION_Y){
+        world->player.yLocation = RESOLUTION_Y - world->player.radius;
+        world->player.yFraction = 0;
+    }
+    invalidate_pairs(PAIR_PLAYER);
 }
 
 // Function 9: Press [Enter] Button to Start
 void start_input(){
-    pauseGame = false;
+    game.pauseGame = false;
     startGame = true;
     restartGame = true;
 }
 
 // Function 10: Press [Space] Button to Pause or Resume
 void pause_input(){
-    pauseGame = true;
+    game.pauseGame = true;
 }
 
 /* *************************************** Graphics Drawing Functions Area ******************************************** */
 
 // Function 11: Draw Main Function
 void plot_game(){
+    begin_frame(BLACK);
+    
     plot_player();
     
     plot_food();
     
     plot_AI();
+    
+    render_frame();
 }
 
 // Function 12: Plot Food
 void plot_food(){
-    for(int i = 0; i < FOOD_NUM; i++){
-        if(!food[i].isEaten){
-            plot_circle(food[i]);
-        }else{
-            food[i].radius = 1;
-            food[i].color = color[rand()%9];
-            food[i].isEaten = false;
-            
-            food[i].xLocation = (int)(rand() % RESOLUTION_X);
-            food[i].yLocation = (int)(rand() % RESOLUTION_Y);
-            
-            while(overlapPlayer(food[i])){
-                food[i].xLocation = (int)(rand() % RESOLUTION_X);
-                food[i].yLocation = (int)(rand() % RESOLUTION_Y);
-            }
-        }
-    }
+    for(int i = 0; i < frameSnapshot.foodNum; i++)
+        plot_circle(frameSnapshot.food[i]);
 }
 
 // Function 13: Plot AI Balls
 void plot_AI(){
-    for (int i = 0; i < AI_NUM; i++){
-      if (!AI[i].isEaten){
-          plot_circle(AI[i]);
-      }else{
-          AI[i].color = color[rand()%9];   //rand()%256  随机取值 0-255
-          AI[i].isEaten = false;
-          if(player.radius > 30)
-              AI[i].radius = (int)(rand() % 10 + player.radius/2 - 7);
-          else if(player.radius > 5)
-              AI[i].radius = (int)(rand() % 10 + player.radius - 5);
-          else
-              AI[i].radius = (int)(rand() % 6 + player.radius - 3);
-          
-
-          AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-          AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-          
-          // AI Balls won't over the boarder
-          while(overlapPlayer(AI[i])){
-              AI[i].xLocation = rand() % (RESOLUTION_X - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-              AI[i].yLocation = rand() % (RESOLUTION_Y - (int)(AI[i].radius + 0.5)) + (int)(AI[i].radius + 0.5);
-          }
-      }
-    }
+    for (int i = 0; i < frameSnapshot.AINum; i++)
+        plot_circle(frameSnapshot.AI[i]);
 }
 
 // Function 14: Plot Player
 void plot_player(){
-    plot_circle(player);
+    plot_circle(frameSnapshot.player);
 }
 
 // Function 15: Clear Screen
@@ -875,16 +1506,6 @@ void clear_screen(){
     }
 }
 
-// Function 15: Clear Screen
-void menu_screen(){
-    for(int x = 0; x < RESOLUTION_X; ++x){
-        for(int y = 0; y < RESOLUTION_Y; ++y){
-            if(*(short int *)(pixel_buffer_start + (y << 10) + (x << 1)) != WHITE)
-                plot_pixel(x, y, WHITE);
-        }
-    }
-}
-
 // Function 16: Plot pixels
 void plot_pixel(int x, int y, short int color){
     if(x >= 0 && x < RESOLUTION_X && y >= 0 && y < RESOLUTION_Y)
@@ -893,28 +1514,7 @@ void plot_pixel(int x, int y, short int color){
 
 // Function 17: Plot Circle
 void plot_circle(Ball ball){
-    int x = ball.xLocation;
-    int y = ball.yLocation;
-    int r = ball.radius;
-    short int color = ball.color;
-    
-    int count = 0;
-    int d = 3-2*r;
-    
-    while(r > count){
-        draw_line(-count+x, r+y, count+x, r+y, color);
-        draw_line(-r+x, count+y, r+x, count+y, color);
-        draw_line(-count+x, -r+y, count+x, -r+y, color);
-        draw_line(-r+x, -count+y, r+x, -count+y, color);
-        
-        if(d < 0){
-            d = d + 4*count + 6;
-        }else{
-            d = d + 4*(count - r) + 10;
-            r--;
-        }
-        count++;
-    }
+    submit_circle(ball.xLocation, ball.yLocation, ball.radius, ball.color);
 }
 
 // Function 18: Plot lines
@@ -965,316 +1565,2807 @@ void draw_line(int startX, int startY, int endX, int endY, short int color){
     }
 }
 
-/* *************************************** Graphics Update Functions Area ********************************************* */
-
-// Function 19: Update Main Fuction
-void update_game(){
-    AI_update();
-    update_score();
-}
+/* ***************************************** Tile Renderer Functions Area ********************************************* */
 
-// Function 21: AI Movement
-void AI_update(){
-    for (int i = 0; i < AI_NUM; i++){
-        // check if the position is out of bounds
-        if((AI[i].xLocation - AI[i].radius) == 0){
-            AI[i].xLocation += 1;
-        }else if((AI[i].xLocation + AI[i].radius) == RESOLUTION_X){
-            AI[i].xLocation -= 1;
-        }
-        
-        if((AI[i].yLocation - AI[i].radius) == 0){
-            AI[i].yLocation += 1;
-        }else if((AI[i].yLocation + AI[i].radius) == RESOLUTION_Y){
-            AI[i].yLocation -= 1;
-        }else{
-            // Initialise as max distance
-            double minDistanceBall = RESOLUTION_X;
-            double minDistanceFood = RESOLUTION_X;
-            
-            // The Number of minmum ball
-            int minBall = -1;
-            int minFood = -1;
-       
-            // Find a smaller ball
-            if(!AI[i].isEaten){
-                // AI approaches AI
-                for (int k = i + 1; k < AI_NUM; k++){
-                    if (AI[i].radius > AI[k].radius && !AI[k].isEaten){
-                        // Store the Number of target ball
-                        if (findDistance(AI[i], AI[k]) < minDistanceBall){
-                            minDistanceBall = findDistance(AI[i], AI[k]);
-                            minBall = k;
-                        }
-                    }
-                }
-                
-                // AI approaches Food
-                for (int k = i + 1; k < FOOD_NUM; k++){
-                    if (minBall == -1 && !food[k].isEaten){
-                        // Store the Number of target ball
-                        if (findDistance(AI[i], food[k]) < minDistanceFood){
-                            minDistanceFood = findDistance(AI[i], food[k]);
-                            minFood = k;
-                        }
-                    }
-                }
-            }
-            
-            // Chase
-            if ((minBall != -1)){
-                AIChase(&AI[i], &AI[minBall]);
-            }else{
-                AIChase(&AI[i], &food[minFood]);
-            }
+// Function 40: Start collecting draw commands of a new frame
+void begin_frame(short int background){
+    // Scratch of the last frame is dropped with one store
+    arena_reset(&frameArena);
+    drawCommands = arena_alloc(&frameArena, MAX_DRAW_COMMANDS * sizeof(DrawCommand));
+    drawCommandNum = 0;
+    pointNum = 0;
+    spanCacheFrame++;
+    frameBackground = background;
+    
+    for(int row = 0; row < TILE_ROWS; row++){
+        for(int col = 0; col < TILE_COLS; col++){
+            tileBinNum[row][col] = 0;
+            tilePointNum[row][col] = 0;
         }
     }
 }
 
-// Function 22: Chase Algorithm
-void AIChase(Ball *chase, Ball *run){
+// Function 41: Queue a filled circle
+void submit_circle(int x, int y, int radius, short int color){
+    if(radius <= 0 || drawCommandNum == MAX_DRAW_COMMANDS)
+        return;
     
-    int N = (chase->radius)/30;
-    double chaseSpeed = 21 / (chase->radius);
-    double runSpeed = 21 / (run->radius);
+    if(radius <= POINT_MAX_RADIUS){
+        submit_point(x, y, radius, color);
+        return;
+    }
     
-    if(chaseSpeed < 1) chaseSpeed = 1;
-    if(runSpeed < 1) runSpeed = 1;
+    // AIs keep growing, the spill space only has to hold circles up to this size
+    if(radius > DRAW_MAX_RADIUS)
+        radius = DRAW_MAX_RADIUS;
     
-    if(rand() % N == 0 || (N<1 && rand()%15 == 0)){
-        if(rand() % 2 == 0){
-            if(chase->xLocation < run->xLocation){
-                chase->xLocation += chaseSpeed;
-            } else {
-                chase->xLocation -= chaseSpeed;
-            }
-        } else {
-            if (chase->yLocation < run->yLocation){
-                chase->yLocation += chaseSpeed;
-            } else {
-                chase->yLocation -= chaseSpeed;
-            }
-        }
-        
-        if(run->radius != 1 && chase->radius >= 4*(run->radius)/3){
-            if(rand() % 2 == 0){
-                if(chase->xLocation < run->xLocation){
-                    run->xLocation -= runSpeed;
-                } else {
-                    run->xLocation += runSpeed;
-                }
-            } else {
-                if (chase->yLocation < run->yLocation){
-                    run->yLocation -= runSpeed;
-                } else {
-                    run->yLocation += runSpeed;
-                }
-            }
-        }
-        
+    DrawCommand *command = &drawCommands[drawCommandNum];
+    
+    // Spans come from the cache, the pointer is set in render_frame once nothing moves any more.
+    // A radius the cache cannot hold this frame gets its own spans in the frame arena
+    command->spans = NULL;
+    if(radius > SPAN_CACHE_MAX_RADIUS || span_cache_lookup(radius) == -1){
+        short int *spans = arena_alloc(&frameArena, (2*radius + 1) * sizeof(short int));
+        circle_spans(radius, spans);
+        command->spans = spans;
     }
+    
+    command->type = DRAW_CIRCLE;
+    command->color = color;
+    command->xLocation = x;
+    command->yLocation = y;
+    command->width = radius;
+    command->height = 2*radius + 1;
+    command->hidden = false;
+    
+    drawCommandNum++;
 }
 
-/* ************************************** Graphics React Functions Area *********************************************** */
+// Function 103: Queue a tiny circle, consecutive ones share one command
+void submit_point(int x, int y, int radius, short int color){
+    if(pointNum == MAX_POINTS)
+        return;
+    
+    DrawCommand *command = &drawCommands[drawCommandNum - 1];
+    if(drawCommandNum == 0 || command->type != DRAW_POINTS){
+        command = &drawCommands[drawCommandNum++];
+        command->type = DRAW_POINTS;
+        command->hidden = false;
+        command->first = pointNum;
+        command->count = 0;
+    }
+    
+    Point *point = &points[pointNum++];
+    point->xLocation = x;
+    point->yLocation = y;
+    point->radius = radius;
+    point->color = color;
+    point->hidden = false;
+    command->count++;
+}
 
-// Function 23: Graphics React Main Function
-void game_react(){
-    playerEatFood();
-    AIEatFood();
-    playerEatAI();
+// Function 42: Queue a filled rectangle
+void submit_rect(int x, int y, int width, int height, short int color){
+    if(drawCommandNum == MAX_DRAW_COMMANDS)
+        return;
+    
+    DrawCommand *command = &drawCommands[drawCommandNum];
+    command->type = DRAW_RECT;
+    command->color = color;
+    command->xLocation = x;
+    command->yLocation = y;
+    command->width = width;
+    command->height = height;
+    command->hidden = false;
+    
+    drawCommandNum++;
 }
 
-// Function 24: Player Eat Food
-void playerEatFood(){
-    for (int i = 0; i < FOOD_NUM; i++){
-        if (!food[i].isEaten){
-            
-            if(player.xLocation != player.lastXLocation){
-                int midPoint = (player.xLocation + player.lastXLocation) / 2;
-                if((findDistanceForPlayer(food[i], player.xLocation, player.yLocation) < (player.radius + 3)) || (findDistanceForPlayer(food[i], midPoint, player.yLocation) < (player.radius + 3)) ){
-                        food[i].isEaten = true;
-                        player.radius += food[i].radius;
-                }
-            }else if(player.yLocation != player.lastYLocation){
-                int midPoint = (player.yLocation + player.lastYLocation) / 2;
-                if( (findDistanceForPlayer(food[i], player.xLocation, player.yLocation) < (player.radius + 3)) || (findDistanceForPlayer(food[i], player.xLocation, midPoint) < (player.radius + 3)) ){
-                        food[i].isEaten = true;
-                        player.radius += food[i].radius;
-                }
-            }
+// Function 43: Queue a picture
+void submit_sprite(const uint16_t *sprite, int x, int y, int width, int height){
+    if(drawCommandNum == MAX_DRAW_COMMANDS)
+        return;
+    
+    DrawCommand *command = &drawCommands[drawCommandNum];
+    command->type = DRAW_SPRITE;
+    command->xLocation = x;
+    command->yLocation = y;
+    command->width = width;
+    command->height = height;
+    command->sprite = sprite;
+    command->hidden = false;
+    
+    drawCommandNum++;
+}
 
+// Function 44: Add a command to every tile its bounding box touches
+void bin_command(int index, int left, int top, int right, int bottom){
+    if(left < 0) left = 0;
+    if(top < 0) top = 0;
+    if(right >= RESOLUTION_X) right = RESOLUTION_X - 1;
+    if(bottom >= RESOLUTION_Y) bottom = RESOLUTION_Y - 1;
+    if(left > right || top > bottom)
+        return;
+    
+    for(int row = top / TILE_SIZE; row <= bottom / TILE_SIZE; row++){
+        for(int col = left / TILE_SIZE; col <= right / TILE_SIZE; col++){
+            tileBin[row][col][tileBinNum[row][col]++] = index;
         }
     }
 }
 
-// Function 25: AI Eat Food & AI
-void AIEatFood(){
-    for (int i = 0; i < AI_NUM; i++){
-      if (AI[i].isEaten)
-        continue;
-        
-      // AI eat food
-      for (int j = 0; j < FOOD_NUM; j++){
-          if (!food[j].isEaten && findDistance(AI[i], food[j]) < AI[i].radius){
-            food[j].isEaten = true;
-            AI[i].radius += food[i].radius;
-          }
-      }
+// Function 45: Half width of every row of a circle, same pixels as the midpoint algorithm with draw_line
+// Row y + dy covers x - spans[dy + r] to x + spans[dy + r] - 1
+void circle_spans(int r, short int *spans){
+    for(int i = 0; i <= 2*r; i++)
+        spans[i] = 0;
+    
+    int radius = r;
+    int count = 0;
+    int d = 3-2*r;
+    
+    while(r > count){
+        if(spans[radius + r] < count) spans[radius + r] = count;
+        if(spans[radius - r] < count) spans[radius - r] = count;
+        if(spans[radius + count] < r) spans[radius + count] = r;
+        if(spans[radius - count] < r) spans[radius - count] = r;
         
-      // Ai eat Ai
-      for (int k = i + 1; k < AI_NUM; k++){
-        if (!AI[k].isEaten){
-            if (findDistance(AI[i], AI[k]) < AI[k].radius - AI[i].radius/3){
-                AI[i].isEaten = true;
-                if(AI[k].radius < 50) AI[k].radius += AI[i].radius / 5;
-                else AI[k].radius += AI[i].radius / 5;
-          }else if (findDistance(AI[i], AI[k]) < AI[i].radius - AI[k].radius/3){
-              AI[k].isEaten = true;
-              if(AI[i].radius < 50) AI[i].radius += AI[k].radius / 5;
-              else AI[i].radius += AI[k].radius / 10;
-          }
+        if(d < 0){
+            d = d + 4*count + 6;
+        }else{
+            d = d + 4*(count - r) + 10;
+            r--;
         }
-      }
+        count++;
     }
 }
 
-// Function 26: Player Eat AI or AI Eat Player
-void playerEatAI(){
-    for (int i = 0; i < AI_NUM; i++){
-        if (AI[i].isEaten)
-            continue;
-        
-        // Player Eat AI
-        if (findDistance(AI[i], player) < player.radius - AI[i].radius/3){
-            AI[i].isEaten = true;
-            player.radius += AI[i].radius / 4;
-            break;
-        }
-        
-        // AI eat player
-        else if (findDistance(AI[i], player) < AI[i].radius - player.radius/3){
-            endGame = true;
+// Function 101: Entry holding the half widths of a radius, filled on first use
+// Returns -1 if the radius does not fit next to the radii of the current frame
+int span_cache_lookup(int radius){
+    int entry = spanEntryOf[radius] - 1;
+    
+    if(entry != -1){
+        spanEntries[entry].lastUsed = spanCacheFrame;
+        spanCacheHits++;
+        return entry;
+    }
+    
+    int size = 2*radius + 1;
+    while(spanEntryNum == SPAN_CACHE_ENTRIES || spanCacheUsed + size > SPAN_CACHE_SIZE){
+        if(!span_cache_evict())
+            return -1;
+    }
+    
+    entry = spanEntryNum++;
+    spanEntries[entry].radius = radius;
+    spanEntries[entry].offset = spanCacheUsed;
+    spanEntries[entry].lastUsed = spanCacheFrame;
+    spanEntryOf[radius] = entry + 1;
+    
+    circle_spans(radius, &spanCache[spanCacheUsed]);
+    spanCacheUsed += size;
+    spanCacheMisses++;
+    return entry;
+}
+
+// Function 102: Drop the least recently used radius and close the gap it leaves
+bool span_cache_evict(){
+    int victim = -1;
+    
+    for(int i = 0; i < spanEntryNum; i++){
+        if(spanEntries[i].lastUsed == spanCacheFrame)
+            continue;
+        if(victim == -1 || spanEntries[i].lastUsed < spanEntries[victim].lastUsed)
+            victim = i;
+    }
+    if(victim == -1)
+        return false;
+    
+    int offset = spanEntries[victim].offset;
+    int size = 2*spanEntries[victim].radius + 1;
+    
+    memmove(&spanCache[offset], &spanCache[offset + size], (spanCacheUsed - offset - size) * sizeof(short int));
+    spanCacheUsed -= size;
+    spanEntryOf[spanEntries[victim].radius] = 0;
+    
+    // Later entries move down one place and size shorts
+    for(int i = victim; i < spanEntryNum - 1; i++){
+        spanEntries[i] = spanEntries[i + 1];
+        spanEntries[i].offset -= size;
+        spanEntryOf[spanEntries[i].radius] = i + 1;
+    }
+    spanEntryNum--;
+    return true;
+}
+
+// Function 46: Rasterize every tile that is drawn now or was drawn last time in this buffer
+void render_frame(){
+    // Eviction compacts the cache, so spans are only looked up after the last submit
+    for(int i = 0; i < drawCommandNum; i++){
+        if(drawCommands[i].type == DRAW_CIRCLE && drawCommands[i].spans == NULL)
+            drawCommands[i].spans = &spanCache[spanEntries[spanEntryOf[drawCommands[i].width] - 1].offset];
+    }
+    
+    // Circles nobody would see are dropped before binning
+    cull_hidden_circles();
+    bin_commands();
+    
+    
+    int buffer = frame_buffer_index();
+    bool redrawAll = (bufferBackground[buffer] != frameBackground);
+    
+    // The codec FIFO only holds 16 ms of samples, so it is topped up before every band
+    for(int n = 0; n < RENDER_BANDS; n++){
+        audio_update();
+        currentBand.firstRow = n * TILE_ROWS / RENDER_BANDS;
+        currentBand.lastRow = (n + 1) * TILE_ROWS / RENDER_BANDS;
+        render_band(&currentBand, buffer, redrawAll);
+    }
+    
+    bufferBackground[buffer] = frameBackground;
+}
+
+// Function 110: Rasterize the tiles of one band that are drawn now or were drawn last time
+void render_band(RenderBand *band, int buffer, bool redrawAll){
+    for(int row = band->firstRow; row < band->lastRow; row++){
+        for(int col = 0; col < TILE_COLS; col++){
+            bool used = (tileBinNum[row][col] > 0);
+            
+            if(used || redrawAll || tileDirty[buffer][row][col])
+                rasterize_tile(band, row, col);
+            tileDirty[buffer][row][col] = used;
+        }
+    }
+}
+
+// Function 47: Draw one tile in the local buffer then write it out row by row
+void rasterize_tile(RenderBand *band, int row, int col){
+    int left = col * TILE_SIZE;
+    int top = row * TILE_SIZE;
+    int width = (left + TILE_SIZE > RESOLUTION_X) ? RESOLUTION_X - left : TILE_SIZE;
+    int height = (top + TILE_SIZE > RESOLUTION_Y) ? RESOLUTION_Y - top : TILE_SIZE;
+    
+    for(int y = 0; y < height; y++)
+        fill_span(band, y * TILE_SIZE, width, frameBackground);
+    
+    // Points of this tile, walked along with the point runs
+    int cursor = tilePointStart[row][col];
+    int end = cursor + tilePointNum[row][col];
+    
+    for(int i = 0; i < tileBinNum[row][col]; i++){
+        DrawCommand *command = &drawCommands[tileBin[row][col][i]];
+        
+        if(command->type == DRAW_POINTS){
+            rasterize_points(band, command, left, top, width, height, &cursor, end);
+        }else if(command->type == DRAW_CIRCLE){
+            int x = command->xLocation;
+            int y = command->yLocation;
+            int r = command->width;
+            int startY = (y - r > top) ? y - r : top;
+            int endY = (y + r < top + height - 1) ? y + r : top + height - 1;
+            
+            for(int py = startY; py <= endY; py++){
+                int half = command->spans[py - y + r];
+                int startX = (x - half > left) ? x - half : left;
+                int endX = (x + half - 1 < left + width - 1) ? x + half - 1 : left + width - 1;
+                
+                if(startX <= endX)
+                    fill_span(band, (py - top) * TILE_SIZE + startX - left, endX - startX + 1, command->color);
+            }
+        }else{
+            int startX = (command->xLocation > left) ? command->xLocation : left;
+            int startY = (command->yLocation > top) ? command->yLocation : top;
+            int endX = command->xLocation + command->width - 1;
+            int endY = command->yLocation + command->height - 1;
+            if(endX > left + width - 1) endX = left + width - 1;
+            if(endY > top + height - 1) endY = top + height - 1;
+            
+            for(int py = startY; py <= endY && startX <= endX; py++){
+                if(command->type == DRAW_RECT){
+                    fill_span(band, (py - top) * TILE_SIZE + startX - left, endX - startX + 1, command->color);
+                }else{
+                    short int *line = &band->tileBuffer[(py - top) * TILE_SIZE - left];
+                    const uint16_t *pixels = &command->sprite[(py - command->yLocation) * command->width - command->xLocation];
+                    for(int px = startX; px <= endX; px++)
+                        line[px] = pixels[px];
+                }
+            }
+        }
+    }
+    
+    // One burst write per tile row
+    for(int y = 0; y < height; y++){
+        short int *out = (short int *)(pixel_buffer_start + ((top + y) << 10) + (left << 1));
+        memcpy(out, &band->tileBuffer[y * TILE_SIZE], width * sizeof(short int));
+    }
+}
+
+// Function 106: Fill length pixels of the tile being drawn
+void fill_span(RenderBand *band, int offset, int length, short int color){
+    short int *pixels = &band->tileBuffer[offset];
+    for(int x = 0; x < length; x++)
+        pixels[x] = color;
+}
+
+// Function 98: Hide every circle and point that lies inside a larger circle drawn after it
+// Draw order is kept, so the frame is the same pixel for pixel
+void cull_hidden_circles(){
+    // Circles by radius, largest first: only larger circles can cover a circle
+    short int order[MAX_DRAW_COMMANDS];
+    int num = 0;
+    
+    for(int i = 0; i < drawCommandNum; i++){
+        if(drawCommands[i].type != DRAW_CIRCLE)
+            continue;
+        
+        int k = num++;
+        while(k > 0 && drawCommands[order[k - 1]].width < drawCommands[i].width){
+            order[k] = order[k - 1];
+            k--;
+        }
+        order[k] = i;
+    }
+    
+    for(int n = 0; n < num; n++){
+        DrawCommand *below = &drawCommands[order[n]];
+        
+        for(int m = 0; m < n; m++){
+            DrawCommand *above = &drawCommands[order[m]];
+            if(above->width <= below->width)
+                break;
+            
+            if(order[m] > order[n] && circle_covers(above, below->xLocation, below->yLocation, below->width, below->spans)){
+                below->hidden = true;
+                break;
+            }
+        }
+    }
+    
+    // Food is drawn as points before every ball that can swallow it
+    for(int i = 0; i < drawCommandNum; i++){
+        if(drawCommands[i].type != DRAW_POINTS)
+            continue;
+        
+        for(int p = drawCommands[i].first; p < drawCommands[i].first + drawCommands[i].count; p++){
+            Point *point = &points[p];
+            
+            for(int m = 0; m < num; m++){
+                DrawCommand *above = &drawCommands[order[m]];
+                if(above->width <= point->radius)
+                    break;
+                
+                if(order[m] > i && circle_covers(above, point->xLocation, point->yLocation, point->radius, pointSpans[point->radius])){
+                    point->hidden = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Function 99: Every pixel of the circle below, given by its centre, radius and spans, is also a pixel of circle above
+bool circle_covers(DrawCommand *above, int x, int y, int radius, const short int *spans){
+    int dx = x - above->xLocation;
+    int dy = y - above->yLocation;
+    int gap = above->width - radius;
+    
+    // Centres too far apart for the smaller disc to fit
+    if(dx*dx + dy*dy > gap*gap)
+        return false;
+    
+    // Rasterized circles are not exact discs, so compare row by row
+    for(int row = -radius; row <= radius; row++){
+        int half = spans[row + radius];
+        if(half == 0)
+            continue;
+        
+        int aboveRow = row + dy + above->width;
+        if(aboveRow < 0 || aboveRow > 2*above->width)
+            return false;
+        
+        int aboveHalf = above->spans[aboveRow];
+        if(dx - half < -aboveHalf || dx + half > aboveHalf)
+            return false;
+    }
+    return true;
+}
+
+// Function 100: Bin every visible command by its bounding box
+void bin_commands(){
+    for(int i = 0; i < drawCommandNum; i++){
+        DrawCommand *command = &drawCommands[i];
+        if(command->hidden)
+            continue;
+        
+        if(command->type == DRAW_POINTS)
+            bin_point_run(i);
+        else if(command->type == DRAW_CIRCLE)
+            bin_command(i, command->xLocation - command->width, command->yLocation - command->width, command->xLocation + command->width - 1, command->yLocation + command->width);
+        else
+            bin_command(i, command->xLocation, command->yLocation, command->xLocation + command->width - 1, command->yLocation + command->height - 1);
+    }
+    
+    bin_points();
+}
+
+// Function 104: A point run is binned only into the tiles that hold one of its points
+void bin_point_run(int index){
+    DrawCommand *command = &drawCommands[index];
+    int left, top, right, bottom;
+    
+    for(int p = command->first; p < command->first + command->count; p++){
+        if(!point_tiles(&points[p], &left, &top, &right, &bottom))
+            continue;
+        
+        for(int row = top; row <= bottom; row++){
+            for(int col = left; col <= right; col++){
+                int num = tileBinNum[row][col];
+                if(num == 0 || tileBin[row][col][num - 1] != index)
+                    tileBin[row][col][tileBinNum[row][col]++] = index;
+                tilePointNum[row][col]++;
+            }
+        }
+    }
+}
+
+// Sort the points by tile once every run is binned, keeping draw order inside every tile
+void bin_points(){
+    int left, top, right, bottom;
+    
+    // Counting sort: every tile gets a slice of tilePoints
+    int start = 0;
+    for(int row = 0; row < TILE_ROWS; row++){
+        for(int col = 0; col < TILE_COLS; col++){
+            tilePointStart[row][col] = start;
+            start += tilePointNum[row][col];
+            tilePointNum[row][col] = 0;
+        }
+    }
+    
+    for(int p = 0; p < pointNum; p++){
+        if(!point_tiles(&points[p], &left, &top, &right, &bottom))
+            continue;
+        
+        for(int row = top; row <= bottom; row++){
+            for(int col = left; col <= right; col++)
+                tilePoints[tilePointStart[row][col] + tilePointNum[row][col]++] = p;
+        }
+    }
+}
+
+// Tiles touched by the bounding box of a point, false if it is off screen
+bool point_tiles(Point *point, int *left, int *top, int *right, int *bottom){
+    if(point->hidden)
+        return false;
+    
+    int x0 = point->xLocation - point->radius;
+    int y0 = point->yLocation - point->radius;
+    int x1 = point->xLocation + point->radius - 1;
+    int y1 = point->yLocation + point->radius;
+    
+    if(x1 < 0 || y1 < 0 || x0 >= RESOLUTION_X || y0 >= RESOLUTION_Y)
+        return false;
+    
+    *left = ((x0 < 0) ? 0 : x0) / TILE_SIZE;
+    *top = ((y0 < 0) ? 0 : y0) / TILE_SIZE;
+    *right = ((x1 >= RESOLUTION_X) ? RESOLUTION_X - 1 : x1) / TILE_SIZE;
+    *bottom = ((y1 >= RESOLUTION_Y) ? RESOLUTION_Y - 1 : y1) / TILE_SIZE;
+    return true;
+}
+
+// Function 105: Stamp the points of one run that touch the tile
+// Points inside the tile are written without any clipping
+void rasterize_points(RenderBand *band, DrawCommand *command, int left, int top, int width, int height, int *cursor, int end){
+    int last = command->first + command->count;
+    
+    for(; *cursor < end && tilePoints[*cursor] < last; (*cursor)++){
+        Point *point = &points[tilePoints[*cursor]];
+        int r = point->radius;
+        int x = point->xLocation - left;
+        int y = point->yLocation - top;
+        const short int *spans = pointSpans[r];
+        
+        if(x - r >= 0 && x + r <= width && y - r >= 0 && y + r < height){
+            for(int dy = -r; dy <= r; dy++){
+                if(spans[dy + r] > 0)
+                    fill_span(band, (y + dy) * TILE_SIZE + x - spans[dy + r], 2*spans[dy + r], point->color);
+            }
+        }else{
+            for(int dy = -r; dy <= r; dy++){
+                if(y + dy < 0 || y + dy >= height)
+                    continue;
+                
+                int startX = (x - spans[dy + r] > 0) ? x - spans[dy + r] : 0;
+                int endX = (x + spans[dy + r] < width) ? x + spans[dy + r] : width;
+                if(startX < endX)
+                    fill_span(band, (y + dy) * TILE_SIZE + startX, endX - startX, point->color);
+            }
+        }
+    }
+}
+
+// Function 48: Forget what the buffers hold, every tile is drawn next time
+void invalidate_tiles(){
+    for(int buffer = 0; buffer < FRAME_BUFFER_NUM; buffer++){
+        for(int row = 0; row < TILE_ROWS; row++){
+            for(int col = 0; col < TILE_COLS; col++){
+                tileDirty[buffer][row][col] = true;
+            }
+        }
+    }
+}
+
+// Function 49: Which buffer is the back buffer
+int frame_buffer_index(){
+    for(int i = 0; i < FRAME_BUFFER_NUM; i++){
+        if(pixel_buffer_start == frameBuffers[i])
+            return i;
+    }
+    return 0;
+}
+
+/* *************************************** Graphics Update Functions Area ********************************************* */
+
+// Function 54: Hand the finished back buffer to the VGA controller
+// With three buffers this never waits: the frame is queued if a swap is still pending
+void present_frame(){
+#if TRIPLE_BUFFERING
+    int buffer = frame_buffer_index();
+    
+    service_present_queue();
+    queuedBuffer = buffer;
+    service_present_queue();
+#else
+    request_swap();
+    framesPresented++;
+#endif
+}
+
+// Function 55: Pick the buffer for the next frame
+void acquire_back_buffer(){
+#if TRIPLE_BUFFERING
+    service_present_queue();
+    
+    // Newest frame wins: a frame still queued is dropped to free its buffer
+    if(pendingBuffer != -1 && queuedBuffer != -1){
+        queuedBuffer = -1;
+        framesDropped++;
+    }
+    
+    for(int i = 0; i < FRAME_BUFFER_NUM; i++){
+        if(i != displayedBuffer && i != pendingBuffer && i != queuedBuffer){
+            pixel_buffer_start = frameBuffers[i];
+            return;
+        }
+    }
+#else
+    while(swap_pending())
+        audio_update();
+    pixel_buffer_start = *(pixel_ctrl_ptr + 1);
+#endif
+}
+
+// Function 56: Retire a finished swap and start the next one from the queue
+void service_present_queue(){
+    if(pendingBuffer != -1 && !swap_pending()){
+        displayedBuffer = pendingBuffer;
+        pendingBuffer = -1;
+    }
+    
+    if(pendingBuffer == -1 && queuedBuffer != -1){
+        *(pixel_ctrl_ptr + 1) = frameBuffers[queuedBuffer];
+        request_swap();
+        pendingBuffer = queuedBuffer;
+        queuedBuffer = -1;
+        framesPresented++;
+    }
+}
+
+// Function 57: Learn the buffer state from the controller after blocking swaps
+void reset_present_queue(){
+    pendingBuffer = -1;
+    queuedBuffer = -1;
+    framesPresented = 0;
+    framesDropped = 0;
+    fpsFrames = 0;
+    
+    for(int i = 0; i < FRAME_BUFFER_NUM; i++){
+        if(*pixel_ctrl_ptr == frameBuffers[i])
+            displayedBuffer = i;
+    }
+}
+
+// Function 129: Frames presented and dropped this round on the JTAG UART
+void present_report(){
+    char report[80];
+    sprintf(report, "frames: %u presented, %u dropped\n", framesPresented, framesDropped);
+    jtag_print(report);
+}
+
+// Function 58: Show the last queued frame and leave the back buffer register ready for wait_for_vsync
+void finish_presenting(){
+#if TRIPLE_BUFFERING
+    while(pendingBuffer != -1 || queuedBuffer != -1)
+        service_present_queue();
+#endif
+    while(swap_pending());
+    pixel_buffer_start = *(pixel_ctrl_ptr + 1);
+}
+
+// Function 52: Simulate one frame, independent of drawing
+void simulate_frame(){
+    // Keep the codec fed
+    audio_update();
+    
+    // code for keyboard input
+    keyboard_input();
+    game.keys = keyState;
+    
+    // Balls eat each other, then the player and the AIs move
+    step_world(&game);
+    
+    // Eats of this frame
+    if(game.sounds & (1 << SFX_EAT))
+        audio_play_sfx(SFX_EAT);
+    if(game.sounds & (1 << SFX_GULP))
+        audio_play_sfx(SFX_GULP);
+    game.sounds = 0;
+}
+
+// Function 53: Freeze the world for the renderer
+void take_snapshot(World *world){
+    frameSnapshot.player = world->player;
+    
+    // Index order, so that eating one ball never changes how the others overlap
+    frameSnapshot.AINum = live_copy(&world->liveAI, world->AI, frameSnapshot.AI);
+    frameSnapshot.foodNum = live_copy(&world->liveFood, world->food, frameSnapshot.food);
+}
+
+// Function 19: Update Main Fuction
+void update_game(World *world){
+    AI_update(world);
+    update_score(world);
+    world->frameCount++;
+}
+
+// Function 21: AI Movement
+void AI_update(World *world){
+    // AIs share one influence map instead of searching food one by one
+    if(world->frameCount % INFLUENCE_PERIOD == 0)
+        build_influence_map(world);
+    
+    // Hunting reuses the distances measured by detection, every move below drops the mover's pairs
+    for (int n = 0; n < world->liveAI.num; n++){
+        int i = world->liveAI.index[n];
+        
+        // check if the position is out of bounds
+        if((world->AI[i].xLocation - world->AI[i].radius) == 0){
+            world->AI[i].xLocation += 1;
+            invalidate_pairs(i);
+        }else if((world->AI[i].xLocation + world->AI[i].radius) == RESOLUTION_X){
+            world->AI[i].xLocation -= 1;
+            invalidate_pairs(i);
+        }
+        
+        if((world->AI[i].yLocation - world->AI[i].radius) == 0){
+            world->AI[i].yLocation += 1;
+        }else if((world->AI[i].yLocation + world->AI[i].radius) == RESOLUTION_Y){
+            world->AI[i].yLocation -= 1;
+        }else{
+            // Keep chasing the same prey, searching again only when it is lost or on a refresh
+            int minBall = track_target(world, n);
+            
+            // Chase close prey, otherwise follow the influence map
+            if (minBall != -1){
+                AIChase(world, &world->AI[i], &world->AI[minBall]);
+                invalidate_pairs(minBall);
+            }else{
+                AISteer(world, &world->AI[i]);
+            }
+        }
+        invalidate_pairs(i);
+    }
+}
+
+// Function 120: Prey of the AI in live slot n, kept across frames
+int track_target(World *world, int n){
+    int i = world->liveAI.index[n];
+    int distance = target_distance(world, n, world->AITarget[i]);
+    bool lost = (world->AITarget[i] != -1 && distance == INT_MAX);
+    
+    if(lost)
+        world->AITarget[i] = -1;
+    
+    // Refreshes are staggered so that only a few AIs search in one frame
+    if(lost || (world->frameCount + i) % TARGET_REFRESH_PERIOD == 0){
+        int nearestDistance;
+        int nearest = find_target(world, n, &nearestDistance);
+        
+        // A target that is still good only gives way to clearly closer prey
+        if(world->AITarget[i] == -1 || (nearest != -1 && nearestDistance * 100 < distance * TARGET_SWITCH_PERCENT))
+            world->AITarget[i] = nearest;
+    }
+    
+    return world->AITarget[i];
+}
+
+// Function 121: Nearest smaller AI within hunting range, among the AIs after live slot n
+int find_target(World *world, int n, int *nearestDistance){
+    int i = world->liveAI.index[n];
+    int nearest = -1;
+    *nearestDistance = INT_MAX;
+    
+    for (int m = n + 1; m < world->liveAI.num; m++){
+        int k = world->liveAI.index[m];
+        if (world->AI[k].radius >= world->AI[i].radius)
+            continue;
+        
+        int distance = pair_distance(world, i, k);
+        if (within_reach(distance, HUNT_RANGE + world->AI[i].radius) && distance < *nearestDistance){
+            *nearestDistance = distance;
+            nearest = k;
+        }
+    }
+    return nearest;
+}
+
+// Function 122: Squared distance to a kept target, INT_MAX if it is no longer prey
+int target_distance(World *world, int n, int target){
+    int i = world->liveAI.index[n];
+    
+    if(target == -1 || world->AI[target].isEaten)
+        return INT_MAX;
+    if(world->liveAI.slot[target] <= n || world->AI[target].radius >= world->AI[i].radius)
+        return INT_MAX;
+    
+    int distance = pair_distance(world, i, target);
+    return within_reach(distance, HUNT_RANGE + TARGET_HYSTERESIS + world->AI[i].radius) ? distance : INT_MAX;
+}
+
+// Function 22: Chase Algorithm
+void AIChase(World *world, Ball *chase, Ball *run){
+    
+    fixed chaseSpeed = AISpeed[speed_index(chase->radius)];
+    fixed runSpeed = AISpeed[speed_index(run->radius)];
+    
+    if(AICanMove(world, chase)){
+        if(game_rand(world) % 2 == 0){
+            if(chase->xLocation < run->xLocation){
+                move_ball(chase, chaseSpeed, 0);
+            } else {
+                move_ball(chase, -chaseSpeed, 0);
+            }
+        } else {
+            if (chase->yLocation < run->yLocation){
+                move_ball(chase, 0, chaseSpeed);
+            } else {
+                move_ball(chase, 0, -chaseSpeed);
+            }
+        }
+        
+        if(run->radius != 1 && chase->radius >= 4*(run->radius)/3){
+            if(game_rand(world) % 2 == 0){
+                if(chase->xLocation < run->xLocation){
+                    move_ball(run, -runSpeed, 0);
+                } else {
+                    move_ball(run, runSpeed, 0);
+                }
+            } else {
+                if (chase->yLocation < run->yLocation){
+                    move_ball(run, 0, -runSpeed);
+                } else {
+                    move_ball(run, 0, runSpeed);
+                }
+            }
+        }
+        
+    }
+}
+
+// Function 34: Decide if an AI moves in this frame
+// Big balls move every N frames, balls under radius 30 move one frame in 15
+bool AICanMove(World *world, Ball *ball){
+    int N = (ball->radius)/30;
+    
+    if(N < 1)
+        return game_rand(world) % 15 == 0;
+    return game_rand(world) % N == 0;
+}
+
+// Function 83: Move a ball by a sub-pixel amount
+void move_ball(Ball *ball, fixed dx, fixed dy){
+    fixed x = INT_TO_FIXED(ball->xLocation) + ball->xFraction + dx;
+    fixed y = INT_TO_FIXED(ball->yLocation) + ball->yFraction + dy;
+    
+    ball->xLocation = FIXED_TO_INT(x);
+    ball->yLocation = FIXED_TO_INT(y);
+    ball->xFraction = x & (FIXED_ONE - 1);
+    ball->yFraction = y & (FIXED_ONE - 1);
+}
+
+// Function 84: Speeds by radius, so that no division is left in the move code
+void initial_speed_table(){
+    // Built once, before any server worker steps a world
+    if(AISpeed[1] != 0)
+        return;
+    
+    for(int r = 1; r < SPEED_TABLE_SIZE; r++){
+        playerSpeed[r] = INT_TO_FIXED(80) / r;
+        if(r > 10) playerSpeed[r] = INT_TO_FIXED(8);
+        if(r > SPEED_STEP_6) playerSpeed[r] = INT_TO_FIXED(6);
+        if(r > SPEED_STEP_4) playerSpeed[r] = INT_TO_FIXED(4);
+        if(r > SPEED_STEP_2) playerSpeed[r] = INT_TO_FIXED(2);
+        
+        // The ladder above is per key press, the player now moves every tick
+        playerSpeed[r] /= TICKS_PER_STEP;
+        playerDiagonalSpeed[r] = (fixed)((long long)playerSpeed[r] * FIXED_DIAGONAL >> FIXED_SHIFT);
+        
+        AISpeed[r] = INT_TO_FIXED(21) / r;
+        if(AISpeed[r] < FIXED_ONE) AISpeed[r] = FIXED_ONE;
+    }
+    playerSpeed[0] = playerSpeed[1];
+    playerDiagonalSpeed[0] = playerDiagonalSpeed[1];
+    AISpeed[0] = AISpeed[1];
+}
+
+int speed_index(int radius){
+    if(radius < 1) return 1;
+    if(radius >= SPEED_TABLE_SIZE) return SPEED_TABLE_SIZE - 1;
+    return radius;
+}
+
+/* ***************************************** Influence Map Functions Area ********************************************* */
+
+// Function 35: Rebuild the influence map shared by all AIs
+void build_influence_map(World *world){
+    for(int row = 0; row < INFLUENCE_ROWS; row++){
+        for(int col = 0; col < INFLUENCE_COLS; col++){
+            world->influenceFood[row][col] = 0;
+            world->influenceThreat[row][col] = 0;
+            world->influenceTarget[row][col] = -1;
+        }
+    }
+    
+    // Food density
+    for(int n = 0; n < world->liveFood.num; n++){
+        int i = world->liveFood.index[n];
+        int col = world->food[i].xLocation / INFLUENCE_CELL;
+        int row = world->food[i].yLocation / INFLUENCE_CELL;
+        if(col < 0 || col >= INFLUENCE_COLS || row < 0 || row >= INFLUENCE_ROWS)
+            continue;
+        
+        world->influenceFood[row][col] += INFLUENCE_FOOD_WEIGHT;
+        world->influenceTarget[row][col] = i;
+    }
+    
+    // Spread the density so that AIs far away from food still see a slope
+    // Forward sweep takes left and upper cells, backward sweep takes right and lower cells
+    for(int row = 0; row < INFLUENCE_ROWS; row++){
+        for(int col = 0; col < INFLUENCE_COLS; col++){
+            if(col > 0 && world->influenceFood[row][col-1] - INFLUENCE_DECAY > world->influenceFood[row][col])
+                world->influenceFood[row][col] = world->influenceFood[row][col-1] - INFLUENCE_DECAY;
+            if(row > 0 && world->influenceFood[row-1][col] - INFLUENCE_DECAY > world->influenceFood[row][col])
+                world->influenceFood[row][col] = world->influenceFood[row-1][col] - INFLUENCE_DECAY;
+        }
+    }
+    for(int row = INFLUENCE_ROWS - 1; row >= 0; row--){
+        for(int col = INFLUENCE_COLS - 1; col >= 0; col--){
+            if(col < INFLUENCE_COLS - 1 && world->influenceFood[row][col+1] - INFLUENCE_DECAY > world->influenceFood[row][col])
+                world->influenceFood[row][col] = world->influenceFood[row][col+1] - INFLUENCE_DECAY;
+            if(row < INFLUENCE_ROWS - 1 && world->influenceFood[row+1][col] - INFLUENCE_DECAY > world->influenceFood[row][col])
+                world->influenceFood[row][col] = world->influenceFood[row+1][col] - INFLUENCE_DECAY;
+        }
+    }
+    
+    // Threat: every ball marks the cells it covers plus one cell around
+    for(int n = 0; n <= world->liveAI.num; n++){
+        Ball *ball = (n == world->liveAI.num) ? &world->player : &world->AI[world->liveAI.index[n]];
+        int left = (ball->xLocation - ball->radius) / INFLUENCE_CELL - 1;
+        int right = (ball->xLocation + ball->radius) / INFLUENCE_CELL + 1;
+        int top = (ball->yLocation - ball->radius) / INFLUENCE_CELL - 1;
+        int bottom = (ball->yLocation + ball->radius) / INFLUENCE_CELL + 1;
+        
+        if(left < 0) left = 0;
+        if(top < 0) top = 0;
+        if(right >= INFLUENCE_COLS) right = INFLUENCE_COLS - 1;
+        if(bottom >= INFLUENCE_ROWS) bottom = INFLUENCE_ROWS - 1;
+        
+        for(int row = top; row <= bottom; row++){
+            for(int col = left; col <= right; col++){
+                if(ball->radius > world->influenceThreat[row][col])
+                    world->influenceThreat[row][col] = ball->radius;
+            }
+        }
+    }
+}
+
+// Function 36: How much an AI wants to be in a cell
+int influence_score(World *world, Ball *ball, int row, int col){
+    int score = world->influenceFood[row][col];
+    
+    if(world->influenceThreat[row][col] > ball->radius)
+        score -= INFLUENCE_THREAT_PENALTY;
+    return score;
+}
+
+// Function 37: Move AI along the gradient of the influence map
+void AISteer(World *world, Ball *ball){
+    static const int dirX[4] = {1, -1, 0, 0};
+    static const int dirY[4] = {0, 0, 1, -1};
+    
+    int col = ball->xLocation / INFLUENCE_CELL;
+    int row = ball->yLocation / INFLUENCE_CELL;
+    if(col < 0) col = 0;
+    if(row < 0) row = 0;
+    if(col >= INFLUENCE_COLS) col = INFLUENCE_COLS - 1;
+    if(row >= INFLUENCE_ROWS) row = INFLUENCE_ROWS - 1;
+    
+    // Best of the current cell and its four neighbours
+    int bestScore = influence_score(world, ball, row, col);
+    int bestDir = -1;
+    for(int d = 0; d < 4; d++){
+        int nextCol = col + dirX[d];
+        int nextRow = row + dirY[d];
+        if(nextCol < 0 || nextCol >= INFLUENCE_COLS || nextRow < 0 || nextRow >= INFLUENCE_ROWS)
+            continue;
+        
+        int score = influence_score(world, ball, nextRow, nextCol);
+        if(score > bestScore){
+            bestScore = score;
+            bestDir = d;
+        }
+    }
+    
+    // Already in the best cell, go for the food inside it
+    if(bestDir == -1){
+        int target = world->influenceTarget[row][col];
+        if(target != -1 && !world->food[target].isEaten)
+            AIChase(world, ball, &world->food[target]);
+        return;
+    }
+    
+    if(!AICanMove(world, ball))
+        return;
+    
+    fixed speed = AISpeed[speed_index(ball->radius)];
+    
+    move_ball(ball, dirX[bestDir] * speed, dirY[bestDir] * speed);
+    
+    // AI Balls won't over the boarder
+    if(ball->xLocation - ball->radius < 0) ball->xLocation = ball->radius;
+    if(ball->yLocation - ball->radius < 0) ball->yLocation = ball->radius;
+    if(ball->xLocation + ball->radius > RESOLUTION_X) ball->xLocation = RESOLUTION_X - ball->radius;
+    if(ball->yLocation + ball->radius > RESOLUTION_Y) ball->yLocation = RESOLUTION_Y - ball->radius;
+}
+
+/* ************************************** Graphics React Functions Area *********************************************** */
+
+// Function 23: Graphics React Main Function
+void game_react(World *world){
+    // Detection only reads the world, every consequence waits for the resolve pass
+    int mark = begin_eat_events(world);
+    playerEatFood(world);
+    detect_scheduled_eats(world);
+    end_eat_events(world, mark);
+    
+    respawn_food(world);
+    respawn_AI(world);
+}
+
+// Function 38: Eaten Foods Come Back Somewhere Else
+void respawn_food(World *world){
+    // Dead foods are the clear bits of the alive set
+    for(int word = 0; word < (FOOD_NUM + 31) / 32; word++){
+      unsigned int dead = ~world->liveFood.alive[word];
+      if(word == FOOD_NUM / 32)
+          dead &= (1u << (FOOD_NUM % 32)) - 1;
+      
+      while(dead){
+        int i = word * 32 + __builtin_ctz(dead);
+        dead &= dead - 1;
+        
+        world->food[i].radius = 1;
+        world->food[i].color = color[game_rand(world)%9];
+        world->food[i].isEaten = false;
+        world->food[i].xFraction = 0;
+        world->food[i].yFraction = 0;
+        
+        world->food[i].xLocation = (int)(game_rand(world) % RESOLUTION_X);
+        world->food[i].yLocation = (int)(game_rand(world) % RESOLUTION_Y);
+        
+        for(int tries = 1; overlapPlayer(world, world->food[i]) && tries < SPAWN_TRIES; tries++){
+            world->food[i].xLocation = (int)(game_rand(world) % RESOLUTION_X);
+            world->food[i].yLocation = (int)(game_rand(world) % RESOLUTION_Y);
+        }
+        
+        live_insert(&world->liveFood, i);
+        foodTouched[i] = true;
+      }
+    }
+}
+
+// Function 39: Eaten AI Balls Come Back Sized After the Player
+void respawn_AI(World *world){
+    for(int word = 0; word < (AI_NUM + 31) / 32; word++){
+      unsigned int dead = ~world->liveAI.alive[word];
+      if(word == AI_NUM / 32)
+          dead &= (1u << (AI_NUM % 32)) - 1;
+      
+      while(dead){
+        int i = word * 32 + __builtin_ctz(dead);
+        dead &= dead - 1;
+        
+        world->AI[i].color = color[game_rand(world)%9];   //rand()%256  随机取值 0-255
+        world->AI[i].isEaten = false;
+        world->AI[i].xFraction = 0;
+        world->AI[i].yFraction = 0;
+        if(world->player.radius > 30)
+            world->AI[i].radius = (int)(game_rand(world) % 10 + world->player.radius/2 - 7);
+        else if(world->player.radius > 5)
+            world->AI[i].radius = (int)(game_rand(world) % 10 + world->player.radius - 5);
+        else
+            world->AI[i].radius = (int)(game_rand(world) % 6 + world->player.radius - 3);
+        
+        world->AI[i].xLocation = game_rand(world) % (RESOLUTION_X - world->AI[i].radius) + world->AI[i].radius;
+        world->AI[i].yLocation = game_rand(world) % (RESOLUTION_Y - world->AI[i].radius) + world->AI[i].radius;
+        
+        // AI Balls won't over the boarder
+        for(int tries = 1; overlapPlayer(world, world->AI[i]) && tries < SPAWN_TRIES; tries++){
+            world->AI[i].xLocation = game_rand(world) % (RESOLUTION_X - world->AI[i].radius) + world->AI[i].radius;
+            world->AI[i].yLocation = game_rand(world) % (RESOLUTION_Y - world->AI[i].radius) + world->AI[i].radius;
+        }
+        
+        live_insert(&world->liveAI, i);
+        invalidate_pairs(i);
+        moverTouched[i] = true;
+        world->AITarget[i] = -1;
+      }
+    }
+}
+
+// Function 87: Live list operations, all O(1) except reset
+void live_reset(LiveList *list){
+    list->num = 0;
+    for(int word = 0; word < LIVE_WORDS; word++)
+        list->alive[word] = 0;
+}
+
+void live_insert(LiveList *list, int index){
+    list->slot[index] = list->num;
+    list->index[list->num++] = index;
+    list->alive[index / 32] |= 1u << (index % 32);
+}
+
+// The last live entity takes the place of the removed one
+void live_remove(LiveList *list, int index){
+    int slot = list->slot[index];
+    int last = list->index[--list->num];
+    
+    list->index[slot] = last;
+    list->slot[last] = slot;
+    list->alive[index / 32] &= ~(1u << (index % 32));
+}
+
+// Live balls packed in index order, walking the set bits of the alive set
+int live_copy(LiveList *list, Ball *balls, Ball *out){
+    int num = 0;
+    
+    for(int word = 0; word < LIVE_WORDS; word++){
+        unsigned int alive = list->alive[word];
+        while(alive){
+            out[num++] = balls[word * 32 + __builtin_ctz(alive)];
+            alive &= alive - 1;
+        }
+    }
+    return num;
+}
+
+// Function 88: Eaten balls leave their live list
+void kill_food(World *world, int i){
+    world->food[i].isEaten = true;
+    live_remove(&world->liveFood, i);
+}
+
+void kill_AI(World *world, int i){
+    world->AI[i].isEaten = true;
+    live_remove(&world->liveAI, i);
+}
+
+// Function 24: Player Eat Food
+void playerEatFood(World *world){
+    // Player only eats while moving, also at the middle of its last step
+    int midX = world->player.xLocation;
+    int midY = world->player.yLocation;
+    
+    if(world->player.xLocation != world->player.lastXLocation)
+        midX = (world->player.xLocation + world->player.lastXLocation) / 2;
+    else if(world->player.yLocation != world->player.lastYLocation)
+        midY = (world->player.yLocation + world->player.lastYLocation) / 2;
+    else
+        return;
+    
+    int mark = arena_mark(&frameArena);
+    unsigned char *eaten = arena_alloc(&frameArena, CIRCLE_SET_MAX);
+    unsigned char *eatenMid = arena_alloc(&frameArena, CIRCLE_SET_MAX);
+    circle_query(foodSet, world->player.xLocation, world->player.yLocation, world->player.radius + PLAYER_EAT_REACH, eaten);
+    circle_query(foodSet, midX, midY, world->player.radius + PLAYER_EAT_REACH, eatenMid);
+    
+    for (int n = 0; n < foodSet->num; n++){
+        if(eaten[n] | eatenMid[n])
+            queue_eat_event(ENTITY_PLAYER, 0, ENTITY_FOOD, world->liveFood.index[n]);
+    }
+    
+    arena_release(&frameArena, mark);
+}
+
+// Function 111: Copy the centres of the live balls of a kind into a circle set
+void build_circle_set(CircleSet *set, LiveList *list, Ball *balls){
+    set->num = list->num;
+    for(int n = 0; n < list->num; n++){
+        set->xy[2 * n] = balls[list->index[n]].xLocation;
+        set->xy[2 * n + 1] = balls[list->index[n]].yLocation;
+    }
+}
+
+// Function 112: mask[j] is 1 for every set entry closer to (x, y) than reach
+// The nearest of them is returned, -1 if none, ties go to the lowest index on every path
+int circle_query(const CircleSet *set, int x, int y, int reach, unsigned char *mask){
+    int limit = (reach > 0) ? reach * reach : 0;
+    int nearest = -1;
+    int nearestDistance = INT_MAX;
+    int j = 0;
+    
+#if defined(__ARM_NEON)
+    int16x4_t qx = vdup_n_s16(x), qy = vdup_n_s16(y);
+    int32x4_t qlimit = vdupq_n_s32(limit);
+    int32x4_t bestDistance = vdupq_n_s32(INT_MAX), bestIndex = vdupq_n_s32(-1);
+    int32x4_t lane = {0, 1, 2, 3};
+    
+    for(; j + 4 <= set->num; j += 4){
+        int16x4x2_t centre = vld2_s16(&set->xy[2 * j]);
+        int16x4_t dx = vsub_s16(centre.val[0], qx);
+        int16x4_t dy = vsub_s16(centre.val[1], qy);
+        int32x4_t distance = vmlal_s16(vmull_s16(dx, dx), dy, dy);
+        uint32x4_t ok = vcltq_s32(distance, qlimit);
+        uint32x4_t better = vandq_u32(ok, vcltq_s32(distance, bestDistance));
+        bestDistance = vbslq_s32(better, distance, bestDistance);
+        bestIndex = vbslq_s32(better, vaddq_s32(lane, vdupq_n_s32(j)), bestIndex);
+        
+        uint32_t lanes[4];
+        vst1q_u32(lanes, ok);
+        for(int k = 0; k < 4; k++)
+            mask[j + k] = lanes[k] & 1;
+    }
+    
+    int32_t distances[4], indices[4];
+    vst1q_s32(distances, bestDistance);
+    vst1q_s32(indices, bestIndex);
+#elif defined(__SSE2__)
+    // Centres are 16-bit x, y pairs, so one multiply-add gives dx*dx + dy*dy per 32-bit lane
+    __m128i query = _mm_set1_epi32((int)(((unsigned int)y << 16) | (x & 0xFFFF)));
+    __m128i qlimit = _mm_set1_epi32(limit);
+    __m128i bestDistance = _mm_set1_epi32(INT_MAX), bestIndex = _mm_set1_epi32(-1);
+    __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+    
+    for(; j + 4 <= set->num; j += 4){
+        __m128i delta = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)&set->xy[2 * j]), query);
+        __m128i distance = _mm_madd_epi16(delta, delta);
+        __m128i ok = _mm_cmplt_epi32(distance, qlimit);
+        __m128i better = _mm_and_si128(ok, _mm_cmplt_epi32(distance, bestDistance));
+        bestDistance = _mm_or_si128(_mm_and_si128(better, distance), _mm_andnot_si128(better, bestDistance));
+        bestIndex = _mm_or_si128(_mm_and_si128(better, _mm_add_epi32(lane, _mm_set1_epi32(j))), _mm_andnot_si128(better, bestIndex));
+        
+        int lanes = _mm_movemask_ps(_mm_castsi128_ps(ok));
+        for(int k = 0; k < 4; k++)
+            mask[j + k] = (lanes >> k) & 1;
+    }
+    
+    int distances[4], indices[4];
+    _mm_storeu_si128((__m128i *)distances, bestDistance);
+    _mm_storeu_si128((__m128i *)indices, bestIndex);
+#endif
+    
+#if defined(__ARM_NEON) || defined(__SSE2__)
+    // Each lane kept its lowest index, so only ties between lanes are left
+    for(int k = 0; k < 4; k++){
+        if(indices[k] != -1 && (distances[k] < nearestDistance || (distances[k] == nearestDistance && indices[k] < nearest))){
+            nearestDistance = distances[k];
+            nearest = indices[k];
+        }
+    }
+#endif
+    
+    // Scalar path, also the tail of the vector paths
+    for(; j < set->num; j++){
+        int dx = set->xy[2 * j] - x;
+        int dy = set->xy[2 * j + 1] - y;
+        int distance = dx*dx + dy*dy;
+        
+        mask[j] = (distance < limit);
+        if(distance < limit && distance < nearestDistance){
+            nearestDistance = distance;
+            nearest = j;
+        }
+    }
+    return nearest;
+}
+
+// Function 117: Squared distance of two pair cache slots, measured at most once per frame
+int pair_distance(World *world, int a, int b){
+    if(a > b){
+        int swap = a;
+        a = b;
+        b = swap;
+    }
+    
+    if(pairStamp[a][b] != pairFrame){
+        Ball *first = &world->AI[a];
+        Ball *second = (b == PAIR_PLAYER) ? &world->player : &world->AI[b];
+        int dx = first->xLocation - second->xLocation;
+        int dy = first->yLocation - second->yLocation;
+        
+        pairDistance[a][b] = dx * dx + dy * dy;
+        pairStamp[a][b] = pairFrame;
+    }
+    return pairDistance[a][b];
+}
+
+// Function 118: A slot has moved, forget every distance it is part of
+void invalidate_pairs(int a){
+    for(int b = 0; b < a; b++)
+        pairStamp[b][a] = 0;
+    for(int b = a; b < PAIR_SLOTS; b++)
+        pairStamp[a][b] = 0;
+}
+
+// Function 119: Same test as the circle kernel, distance below a positive reach
+bool within_reach(int distance, int reach){
+    return reach > 0 && distance < reach * reach;
+}
+
+// Function 123: AI eat food, AI eat AI and player eat AI over the pairs due this frame
+// Events are queued in live slot order: each AI with its food and the AIs after it, then the player pairs
+void detect_scheduled_eats(World *world){
+    refresh_schedule(world);
+    
+    int mark = arena_mark(&frameArena);
+    int *keys = arena_alloc(&frameArena, EAT_EVENT_MAX * sizeof(int));
+    int first = eatEventNum;
+    
+    // Lists of frames without a detection are tested now, the horizon holds them all at most once
+    unsigned int frames = world->frameCount - scheduleFrame;
+    if(frames > SCHEDULE_HORIZON)
+        frames = SCHEDULE_HORIZON;
+    
+    for(unsigned int frame = world->frameCount - frames + 1; frame != world->frameCount + 1; frame++){
+        int pair = scheduleBucket[frame % SCHEDULE_HORIZON];
+        scheduleBucket[frame % SCHEDULE_HORIZON] = -1;
+        
+        while(pair != -1){
+            int next = pairNext[pair];
+            unsigned int due = pairDue[pair];
+            pairDue[pair] = SCHEDULE_NEVER;
+            
+            // A pair of a later frame shares the list, it goes back untested
+            if(due > world->frameCount){
+                schedule_link(pair, due);
+            }else{
+                int key = test_pair(world, pair);
+                if(key != -1)
+                    keys[eatEventNum - 1 - first] = key;
+                schedule_pair(world, pair, world->frameCount + 1);
+            }
+            pair = next;
+        }
+    }
+    scheduleFrame = world->frameCount;
+    
+    // Only a few pairs touch in one frame
+    for(int e = 1; e < eatEventNum - first; e++){
+        int key = keys[e];
+        EatEvent event = eatEvents[first + e];
+        int j = e;
+        for(; j > 0 && keys[j - 1] > key; j--){
+            keys[j] = keys[j - 1];
+            eatEvents[first + j] = eatEvents[first + j - 1];
+        }
+        keys[j] = key;
+        eatEvents[first + j] = event;
+    }
+    
+    arena_release(&frameArena, mark);
+}
+
+// Function 124: Queue the eat event of one pair, returns its place in live slot order or -1
+int test_pair(World *world, int pair){
+    if(pair < SCHEDULE_FOOD_PAIRS){
+        int i = pair / FOOD_NUM;
+        int f = pair % FOOD_NUM;
+        if(world->AI[i].isEaten || world->food[f].isEaten)
+            return -1;
+        
+        int dx = world->AI[i].xLocation - world->food[f].xLocation;
+        int dy = world->AI[i].yLocation - world->food[f].yLocation;
+        if(!within_reach(dx * dx + dy * dy, world->AI[i].radius))
+            return -1;
+        
+        queue_eat_event(ENTITY_AI, i, ENTITY_FOOD, f);
+        return world->liveAI.slot[i] * 2 * LIVE_MAX + world->liveFood.slot[f];
+    }
+    
+    int i = (pair - SCHEDULE_FOOD_PAIRS) / PAIR_SLOTS;
+    int k = (pair - SCHEDULE_FOOD_PAIRS) % PAIR_SLOTS;
+    if(world->AI[i].isEaten)
+        return -1;
+    
+    if(k == PAIR_PLAYER){
+        int distance = pair_distance(world, i, PAIR_PLAYER);
+        
+        if(within_reach(distance, world->player.radius - world->AI[i].radius / 3))
+            queue_eat_event(ENTITY_PLAYER, 0, ENTITY_AI, i);
+        else if(within_reach(distance, world->AI[i].radius - world->player.radius / 3))
+            queue_eat_event(ENTITY_AI, i, ENTITY_PLAYER, 0);
+        else
+            return -1;
+        return AI_NUM * 2 * LIVE_MAX + world->liveAI.slot[i];
+    }
+    
+    if(world->AI[k].isEaten)
+        return -1;
+    
+    // The AI in the lower live slot is i, it is tested first
+    if(world->liveAI.slot[i] > world->liveAI.slot[k]){
+        int swap = i;
+        i = k;
+        k = swap;
+    }
+    
+    int distance = pair_distance(world, i, k);
+    if(within_reach(distance, world->AI[k].radius - world->AI[i].radius / 3))
+        queue_eat_event(ENTITY_AI, k, ENTITY_AI, i);
+    else if(within_reach(distance, world->AI[i].radius - world->AI[k].radius / 3))
+        queue_eat_event(ENTITY_AI, i, ENTITY_AI, k);
+    else
+        return -1;
+    return world->liveAI.slot[i] * 2 * LIVE_MAX + LIVE_MAX + world->liveAI.slot[k];
+}
+
+// Function 125: First frame a pair can touch if both balls close in at full speed, never before earliest
+void schedule_pair(World *world, int pair, unsigned int earliest){
+    unsigned int due = SCHEDULE_NEVER;
+    int distance = 0;
+    int reach = 0;
+    int speed = 1;
+    
+    if(pair < SCHEDULE_FOOD_PAIRS){
+        int i = pair / FOOD_NUM;
+        int f = pair % FOOD_NUM;
+        
+        if(!world->AI[i].isEaten && !world->food[f].isEaten){
+            int dx = world->AI[i].xLocation - world->food[f].xLocation;
+            int dy = world->AI[i].yLocation - world->food[f].yLocation;
+            distance = dx * dx + dy * dy;
+            reach = world->AI[i].radius;
+            speed = mover_speed(world, i);
+        }
+    }else{
+        int a = (pair - SCHEDULE_FOOD_PAIRS) / PAIR_SLOTS;
+        int b = (pair - SCHEDULE_FOOD_PAIRS) % PAIR_SLOTS;
+        
+        // Only a < b is used, the player never dies
+        if(a < b && !world->AI[a].isEaten && !mover_ball(world, b)->isEaten){
+            Ball *other = mover_ball(world, b);
+            int eats = world->AI[a].radius - other->radius / 3;
+            int eaten = other->radius - world->AI[a].radius / 3;
+            
+            distance = pair_distance(world, a, b);
+            reach = (eats > eaten) ? eats : eaten;
+            speed = mover_speed(world, a) + mover_speed(world, b);
+        }
+    }
+    
+    if(reach > 0){
+        // The square root rounds down, so the gap is never overstated
+        int gap = int_sqrt(distance) - reach;
+        due = (gap < 0) ? world->frameCount : world->frameCount + 1 + gap / speed;
+        if(due > world->frameCount + SCHEDULE_HORIZON - 1)
+            due = world->frameCount + SCHEDULE_HORIZON - 1;
+        if(due < earliest)
+            due = earliest;
+    }
+    
+    schedule_unlink(pair);
+    if(due != SCHEDULE_NEVER)
+        schedule_link(pair, due);
+}
+
+// Function 126: Schedule every pair after a new world, otherwise the pairs of balls that changed
+void refresh_schedule(World *world){
+    // The schedule of this thread was built for another world
+    if(scheduleWorld != world){
+        scheduleWorld = world;
+        scheduleStale = true;
+    }
+    
+    if(scheduleStale){
+        scheduleStale = false;
+        scheduleFrame = world->frameCount - 1;
+        for(int bucket = 0; bucket < SCHEDULE_HORIZON; bucket++)
+            scheduleBucket[bucket] = -1;
+        for(int pair = 0; pair < SCHEDULE_PAIRS; pair++){
+            pairDue[pair] = SCHEDULE_NEVER;
+            schedule_pair(world, pair, world->frameCount);
+        }
+        
+        for(int a = 0; a < PAIR_SLOTS; a++){
+            scheduleSeen[a] = *mover_ball(world, a);
+            moverTouched[a] = false;
+        }
+        memset(foodTouched, 0, sizeof(foodTouched));
+        return;
+    }
+    
+    // Pushed runners, border clamps after growth and anything else faster than its speed
+    for(int a = 0; a < PAIR_SLOTS; a++){
+        Ball *ball = mover_ball(world, a);
+        Ball *seen = &scheduleSeen[a];
+        int moved = abs(ball->xLocation - seen->xLocation) + abs(ball->yLocation - seen->yLocation);
+        
+        if(ball->radius != seen->radius || moved > mover_speed(world, a))
+            moverTouched[a] = true;
+        *seen = *ball;
+    }
+    
+    for(int a = 0; a < PAIR_SLOTS; a++){
+        if(!moverTouched[a])
+            continue;
+        moverTouched[a] = false;
+        
+        if(a != PAIR_PLAYER){
+            for(int f = 0; f < FOOD_NUM; f++)
+                schedule_pair(world, a * FOOD_NUM + f, world->frameCount);
+        }
+        for(int b = 0; b < PAIR_SLOTS; b++){
+            if(b != a)
+                schedule_pair(world, SCHEDULE_FOOD_PAIRS + ((a < b) ? a * PAIR_SLOTS + b : b * PAIR_SLOTS + a), world->frameCount);
+        }
+    }
+    
+    for(int f = 0; f < FOOD_NUM; f++){
+        if(!foodTouched[f])
+            continue;
+        foodTouched[f] = false;
+        
+        for(int i = 0; i < AI_NUM; i++)
+            schedule_pair(world, i * FOOD_NUM + f, world->frameCount);
+    }
+}
+
+// Function 127: Pixels a mover can travel between two detections, counted along both axes
+int mover_speed(World *world, int a){
+    int index = speed_index(mover_ball(world, a)->radius);
+    
+    // The player may step along both axes, an AI makes one step and one border nudge
+    if(a == PAIR_PLAYER)
+        return 2 * FIXED_TO_INT(playerSpeed[index] + FIXED_ONE - 1);
+    return FIXED_TO_INT(AISpeed[index] + FIXED_ONE - 1) + 1;
+}
+
+Ball *mover_ball(World *world, int a){
+    return (a == PAIR_PLAYER) ? &world->player : &world->AI[a];
+}
+
+// Function 128: Put a pair in the list of its due frame, or take it out
+void schedule_link(int pair, unsigned int due){
+    int bucket = due % SCHEDULE_HORIZON;
+    
+    pairDue[pair] = due;
+    pairPrev[pair] = -1;
+    pairNext[pair] = scheduleBucket[bucket];
+    if(scheduleBucket[bucket] != -1)
+        pairPrev[scheduleBucket[bucket]] = pair;
+    scheduleBucket[bucket] = pair;
+}
+
+void schedule_unlink(int pair){
+    if(pairDue[pair] == SCHEDULE_NEVER)
+        return;
+    
+    if(pairPrev[pair] != -1)
+        pairNext[pairPrev[pair]] = pairNext[pair];
+    else
+        scheduleBucket[pairDue[pair] % SCHEDULE_HORIZON] = pairNext[pair];
+    if(pairNext[pair] != -1)
+        pairPrev[pairNext[pair]] = pairPrev[pair];
+    pairDue[pair] = SCHEDULE_NEVER;
+}
+
+// Function 113: Eat events and query masks live in the frame arena until the resolve pass is done
+int begin_eat_events(World *world){
+    int mark = arena_mark(&frameArena);
+    
+    eatEvents = arena_alloc(&frameArena, EAT_EVENT_MAX * sizeof(EatEvent));
+    eatEventNum = 0;
+    build_circle_set(foodSet, &world->liveFood, world->food);
+    
+    // Every pair distance of the last frame is stale
+    pairFrame++;
+    return mark;
+}
+
+void end_eat_events(World *world, int mark){
+    resolve_eat_events(world);
+    arena_release(&frameArena, mark);
+}
+
+// Function 90: Eat events of one frame
+void queue_eat_event(int eaterKind, int eater, int victimKind, int victim){
+    EatEvent *event = &eatEvents[eatEventNum++];
+    
+    event->eaterKind = eaterKind;
+    event->eater = eater;
+    event->victimKind = victimKind;
+    event->victim = victim;
+}
+
+Ball *entity_ball(World *world, int kind, int index){
+    if(kind == ENTITY_PLAYER)
+        return &world->player;
+    if(kind == ENTITY_AI)
+        return &world->AI[index];
+    return &world->food[index];
+}
+
+// Function 91: Apply eat events in detection order
+// A ball is eaten at most once, and a ball eaten earlier in the queue no longer eats
+void resolve_eat_events(World *world){
+    bool ateFood = false;
+    bool ateAI = false;
+    
+    for(int e = 0; e < eatEventNum; e++){
+        EatEvent *event = &eatEvents[e];
+        Ball *eater = entity_ball(world, event->eaterKind, event->eater);
+        Ball *victim = entity_ball(world, event->victimKind, event->victim);
+        
+        if(eater->isEaten || victim->isEaten || world->endGame)
+            continue;
+        
+        if(event->victimKind == ENTITY_FOOD){
+            kill_food(world, event->victim);
+            eater->radius += victim->radius;
+            ateFood |= (event->eaterKind == ENTITY_PLAYER);
+        }else if(event->victimKind == ENTITY_PLAYER){
+            world->endGame = true;
+        }else if(event->eaterKind == ENTITY_PLAYER){
+            kill_AI(world, event->victim);
+            world->player.radius += victim->radius / PLAYER_EAT_AI_DIVISOR;
+            ateAI = true;
+        }else{
+            kill_AI(world, event->victim);
+            if(eater->radius < AI_GROWTH_SPLIT) eater->radius += victim->radius / AI_EAT_AI_SMALL_DIVISOR;
+            else eater->radius += victim->radius / AI_EAT_AI_LARGE_DIVISOR;
+        }
+    }
+    
+    eatEventNum = 0;
+    
+    // The board plays them, a world stepped off the board just drops them
+    if(ateFood)
+        world->sounds |= 1 << SFX_EAT;
+    if(ateAI)
+        world->sounds |= 1 << SFX_GULP;
+}
+
+// Function 27:
+void video_text(int x, int y, char * text_ptr) {
+    int offset;
+    volatile char * character_buffer =(char *)FPGA_CHAR_BASE; // video character buffer
+
+    offset = (y << 7) + x;
+    while (*(text_ptr)) {
+        *(character_buffer + offset) =*(text_ptr); // write to the character buffer
+        ++text_ptr;
+        ++offset;
+    }
+}
+
+void display_score(){
+    display_hex();
+    
+    // Text only changes with the score
+    if(frameSnapshot.player.score == textScore)
+        return;
+    textScore = frameSnapshot.player.score;
+    
+    char str[20];
+    sprintf(str, "%d", frameSnapshot.player.score);
+    char text_top_left_first[40] = "Battle of Balls";
+    char text_top_left_second[40] = "Score:\0";
+    char text_bottom_middle[100] = "PRESS SPACE TO PAUSE / PRESS DIRECTION KEY TO CONTROL THE BALL\0";
+    strcat(text_top_left_second,str);
+    video_text(1, 1, text_top_left_first);
+    video_text(1, 3, text_top_left_second);
+    video_text(10, 58, text_bottom_middle);
+}
+
+void display_menutext(){
+        char text_top_row[40] = "BATTLE OF BALLS\0";//15
+        char text_middle_row[40] = "NOTE:WHITE BALLS IS PLAYER\0";//26
+        char text_bottom_row[40] = "PRESS ENTER TO START\0";//20
+        video_text(33, 29, text_top_row);
+        video_text(27, 31, text_middle_row);
+        video_text(30, 50, text_bottom_row);
+}
+
+void display_pausetext(){
+    char pause_text_bottom_row[40] = "PRESS ENTER TO RESUME\0";
+    video_text(30, 31, pause_text_bottom_row);
+}
+
+void display_endingtext(){
+    char str[20];
+    sprintf(str, "%d", game.player.score);
+    char ending_text[40]="Your Final Score is:\0";
+    strcat(ending_text,str);
+    video_text(30, 50, ending_text);
+}
+
+/* *************************************** Score Update Functions Area ************************************************ */
+
+// Function 28:
+void cleartext(){
+    for(int x=0;x<80;x++){
+        for(int y=0;y<60;y++){
+            video_text(x, y, " \0");
+        }
+    }
+    
+    // Score text has to be written again
+    textScore = -1;
+}
+
+//Function 29: upadate score
+void update_score(World *world){
+    world->player.score=(world->player.radius-5)*10;
+}
+
+// Function 92: Score, FPS or entity count on HEX5 to HEX0, chosen by SW1 and SW0
+// Registers are only written when the number changes
+void display_hex(){
+    int switches = *sw_ptr;
+    int value = frameSnapshot.player.score;
+    
+    update_fps();
+    if(switches & SW_SHOW_FPS)
+        value = framesPerSecond;
+    else if(switches & SW_SHOW_ENTITIES)
+        value = frameSnapshot.AINum + frameSnapshot.foodNum + 1;
+    
+    if(value == hexValue)
+        return;
+    hexValue = value;
+    
+    // Digits from HEX0 upwards, leading zeros stay blank
+    unsigned char digits[HEX_DIGITS] = {0};
+    for(int i = 0; i < HEX_DIGITS; i++){
+        digits[i] = hexSegments[value % 10];
+        value /= 10;
+        if(value == 0)
             break;
+    }
+    
+    *hex3_0_ptr = (digits[3] << 24) | (digits[2] << 16) | (digits[1] << 8) | digits[0];
+    *hex5_4_ptr = (digits[5] << 8) | digits[4];
+}
+
+// Function 93: Frames presented during the last full second
+void update_fps(){
+    unsigned int now = read_timer();
+    
+    // Timer counts down
+    if(fpsMark - now < TIMER_FREQUENCY)
+        return;
+    
+    framesPerSecond = framesPresented - fpsFrames;
+    fpsFrames = framesPresented;
+    fpsMark = now;
+}
+
+/* ******************************************* Open Scene & Ending Ssene Functions Area ******************************************* */
+
+// Function 30: Open Scene
+void opening(){
+    int x = RESOLUTION_X/2;
+    int y = RESOLUTION_Y/2;
+    short int color = WHITE;
+    
+    // Draw Circles
+    for(int r = RESOLUTION_X/2; r > 5; r--){
+        int count = 0;
+        int d = 3-2*r;
+        
+        while(r > count){
+            draw_line(-count+x, r+y, count+x, r+y, color);
+            draw_line(-r+x, count+y, r+x, count+y, color);
+            draw_line(-count+x, -r+y, count+x, -r+y, color);
+            draw_line(-r+x, -count+y, r+x, -count+y, color);
+            
+            if(d < 0){
+                d = d + 4*count + 6;
+            }else{
+                d = d + 4*(count - r) + 10;
+                r--;
+            }
+            count++;
+        }
+        
+        wait_for_vsync(); // swap front and back buffers on VGA vertical sync
+        pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
+        
+        // Erase any boxes and lines that were drawn in the last iteration
+        clear_screen();
+    }
+}
+
+/* ***************************************** World Session Functions Area ********************************************* */
+
+// Function 66: Start a new round without video, keyboard or opening animation
+void reset_world(World *world, unsigned int seed){
+    world->endGame = false;
+    world->pauseGame = false;
+    world->frameCount = 0;
+    world->keys = 0;
+    world->sounds = 0;
+    game_srand(world, seed);
+    
+    initial_round_memory();
+    initial_speed_table();
+    initial_player(world);
+    initial_AI(world);
+    initial_food(world);
+    initial_score(world);
+}
+
+// Function 67: One tick of a world, the player follows world->keys, nothing is drawn
+void step_world(World *world){
+    game_react(world);
+    player_move(world);
+    update_game(world);
+    
+    // Player win the Game
+    if(world->player.radius >= WIN_RADIUS)
+        world->endGame = true;
+}
+
+#if HEADLESS_SERVER
+// Function 68: Headless server on a Linux host, a pool of workers steps the worlds SESSION_SLICE ticks at a time
+// Each world runs ticks / num ticks, finished rounds restart right away with a new seed
+void run_sessions(World *worlds, int num, int ticks){
+    serverThreadNum = SERVER_THREADS;
+    if(serverThreadNum == 0)
+        serverThreadNum = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(serverThreadNum < 1) serverThreadNum = 1;
+    if(serverThreadNum > SERVER_THREADS_MAX) serverThreadNum = SERVER_THREADS_MAX;
+    
+    serverWorlds = worlds;
+    for(int t = 0; t < serverThreadNum; t++){
+        pthread_mutex_init(&serverDeques[t].lock, NULL);
+        serverDeques[t].top = 0;
+        serverDeques[t].bottom = 0;
+        serverRounds[t] = 0;
+    }
+    
+    // Worlds are dealt out in turn, workers that run out steal the ones still waiting
+    for(int i = 0; i < num; i++){
+        reset_world(&worlds[i], i + 1);
+        sessionTicksLeft[i] = ticks / num;
+        deque_push(&serverDeques[i % serverThreadNum], i);
+    }
+    
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    
+    // This thread is worker 0
+    for(int t = 1; t < serverThreadNum; t++)
+        pthread_create(&serverThreads[t], NULL, session_worker, (void *)(intptr_t)t);
+    session_worker((void *)0);
+    for(int t = 1; t < serverThreadNum; t++)
+        pthread_join(serverThreads[t], NULL);
+    
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    
+    unsigned int rounds = 0;
+    for(int t = 0; t < serverThreadNum; t++){
+        rounds += serverRounds[t];
+        pthread_mutex_destroy(&serverDeques[t].lock);
+    }
+    
+    unsigned long long done = (unsigned long long)num * (ticks / num);
+    unsigned long long nanoseconds = (unsigned long long)(end.tv_sec - start.tv_sec) * 1000000000ULL + end.tv_nsec - start.tv_nsec;
+    if(nanoseconds == 0) nanoseconds = 1;
+    
+    char report[120];
+    sprintf(report, "%d worlds, %d threads, %llu ticks, %u rounds, %llu ticks/s\n", num, serverThreadNum, done, rounds,
+            done * 1000000000ULL / nanoseconds);
+    jtag_print(report);
+    arena_report(&frameArena);
+    arena_report(&roundArena);
+}
+
+// Function 139: One server worker, runs slices until no world is waiting in any deque
+// A world is either waiting in a deque or held by the worker stepping it, so an empty pool means the run is over
+void *session_worker(void *arg){
+    int self = (int)(intptr_t)arg;
+    
+    if(self != 0)
+        initial_thread_memory();
+    
+    while(true){
+        int i = deque_pop(&serverDeques[self]);
+        for(int k = 1; i < 0 && k < serverThreadNum; k++)
+            i = deque_steal(&serverDeques[(self + k) % serverThreadNum]);
+        if(i < 0)
+            return NULL;
+        
+        World *world = &serverWorlds[i];
+        int slice = (sessionTicksLeft[i] < SESSION_SLICE) ? sessionTicksLeft[i] : SESSION_SLICE;
+        
+        for(int tick = 0; tick < slice; tick++){
+            // Autopilot, the player holds random arrow keys for a while
+            if(world->frameCount % SESSION_STEER_TICKS == 0)
+                world->keys = game_rand(world) & (ARROW_UP | ARROW_RIGHT | ARROW_LEFT | ARROW_DOWN);
+            
+            step_world(world);
+            world->sounds = 0;
+            
+            if(world->endGame){
+                reset_world(world, world->randomSeed);
+                serverRounds[self]++;
+            }
+        }
+        
+        // Back on top of the owner's deque, so the owner keeps a world while it is in its cache
+        sessionTicksLeft[i] -= slice;
+        if(sessionTicksLeft[i] > 0)
+            deque_push(&serverDeques[self], i);
+    }
+}
+
+// Function 140: Work deque of a server worker
+void deque_push(WorkDeque *deque, int world){
+    pthread_mutex_lock(&deque->lock);
+    deque->world[deque->bottom % SESSION_NUM] = world;
+    deque->bottom++;
+    pthread_mutex_unlock(&deque->lock);
+}
+
+// Owner end, -1 if empty
+int deque_pop(WorkDeque *deque){
+    int world = -1;
+    
+    pthread_mutex_lock(&deque->lock);
+    if(deque->bottom > deque->top){
+        deque->bottom--;
+        world = deque->world[deque->bottom % SESSION_NUM];
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return world;
+}
+
+// Thief end, the world that has waited longest, -1 if empty
+int deque_steal(WorkDeque *deque){
+    int world = -1;
+    
+    pthread_mutex_lock(&deque->lock);
+    if(deque->bottom > deque->top){
+        world = deque->world[deque->top % SESSION_NUM];
+        deque->top++;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return world;
+}
+#endif
+
+// Function 69: Free running A9 private timer
+// The server runs on a Linux host, where the monotonic clock counts down the same way
+#if HEADLESS_SERVER
+void start_timer(){
+}
+
+unsigned int read_timer(){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return 0xFFFFFFFF - (unsigned int)((unsigned long long)now.tv_sec * TIMER_FREQUENCY + now.tv_nsec / (1000000000 / TIMER_FREQUENCY));
+}
+#else
+void start_timer(){
+    *(timer_ptr) = 0xFFFFFFFF;       // Load
+    *(timer_ptr + 2) = 0x3;          // Auto reload and enable
+}
+
+unsigned int read_timer(){
+    return *(timer_ptr + 1);
+}
+#endif
+
+// Function 70: Print a line on the JTAG UART, characters that do not fit are dropped
+// On a Linux host the lines go to stdout
+void jtag_print(char *text){
+#if HEADLESS_SERVER
+    fputs(text, stdout);
+    fflush(stdout);
+#else
+    while(*text){
+        if((*(jtag_ptr + 1) & 0xFFFF0000) == 0)
+            return;
+        *(jtag_ptr) = *text;
+        text++;
+    }
+#endif
+}
+
+/* *************************************** Batch Environment Functions Area ******************************************* */
+
+// Function 72: Start num worlds, world w is seeded with seed + w
+void batch_reset(BatchEnv *batch, int num, unsigned int seed){
+    batch->num = num;
+    
+    for(int w = 0; w < num; w++){
+        reset_world(&batch->worlds[w], seed + w);
+        batch_scatter(batch, w);
+    }
+}
+
+// Function 73: Step all worlds in lockstep
+// actions[w] is one of ACTION_*, rewards[w] is the score change, dones[w] is set when the round ended
+// A finished world restarts right away and its observation is the first one of the new round
+// The schedule of detection is rebuilt whenever the world changes, and the masks stand in for it here.
+// Use it when each tick needs a new action, run_sessions is faster when a world can run on for a slice
+void batch_step(BatchEnv *batch, const int *actions, Observation *observations, int *rewards, bool *dones){
+    for(int w = 0; w < batch->num; w++)
+        batch_input(&batch->worlds[w], actions[w]);
+    
+    // Every eat predicate of every world at once
+    batch_player_eat_food(batch);
+    batch_AI_eat(batch);
+    
+    for(int w = 0; w < batch->num; w++){
+        World *world = &batch->worlds[w];
+        int score = world->player.score;
+        
+        // The eat masks stand in for detection, then the rest of game_react and update_game
+        int mark = begin_eat_events(world);
+        batch_queue_eats(batch, w);
+        end_eat_events(world, mark);
+        respawn_food(world);
+        respawn_AI(world);
+        update_game(world);
+        
+        if(world->player.radius >= WIN_RADIUS)
+            world->endGame = true;
+        
+        rewards[w] = world->player.score - score;
+        dones[w] = world->endGame;
+        if(world->endGame)
+            reset_world(world, world->randomSeed);
+        
+        // Nobody plays the sounds of a batch
+        world->sounds = 0;
+        
+        batch_observe(world, &observations[w]);
+        batch_scatter(batch, w);
+    }
+}
+
+// Function 74: Player eat food predicate for all worlds, same test as playerEatFood
+// Branch free over the world index so the compiler can vectorize the inner loop,
+// the bits gather in a local array since stores into the batch could alias its inputs
+void batch_player_eat_food(BatchEnv *batch){
+    int num = batch->num;
+    int x[BATCH_MAX], y[BATCH_MAX];
+    int midX[BATCH_MAX], midY[BATCH_MAX];
+    int reach[BATCH_MAX];
+    unsigned int eats[LIVE_WORDS][BATCH_MAX] = {{0}};
+    
+    for(int w = 0; w < num; w++){
+        Ball *ball = &batch->worlds[w].player;
+        int distance = ball->radius + PLAYER_EAT_REACH;
+        
+        x[w] = midX[w] = ball->xLocation;
+        y[w] = midY[w] = ball->yLocation;
+        reach[w] = distance * distance;
+        
+        // Player only eats while moving
+        if(ball->xLocation != ball->lastXLocation)
+            midX[w] = (ball->xLocation + ball->lastXLocation) / 2;
+        else if(ball->yLocation != ball->lastYLocation)
+            midY[w] = (ball->yLocation + ball->lastYLocation) / 2;
+        else
+            reach[w] = 0;
+    }
+    
+    for(int k = 0; k < FOOD_NUM; k++){
+        const int *foodX = batch->foodX[k];
+        const int *foodY = batch->foodY[k];
+        const int *alive = batch->foodAlive[k];
+        unsigned int *bits = eats[k / 32];
+        
+        for(int w = 0; w < num; w++){
+            int dx = foodX[w] - x[w];
+            int dy = foodY[w] - y[w];
+            int midDX = foodX[w] - midX[w];
+            int midDY = foodY[w] - midY[w];
+            unsigned int hit = alive[w] & ((dx*dx + dy*dy < reach[w]) | (midDX*midDX + midDY*midDY < reach[w]));
+            
+            bits[w] |= hit << (k % 32);
+        }
+    }
+    
+    memcpy(batch->playerEatsFood, eats, sizeof(eats));
+}
+
+// Function 130: AI eat food, AI eat AI and player eat AI predicates for all worlds, same tests as test_pair
+// Every ordered AI pair is tested, batch_queue_eats picks the direction test_pair would
+void batch_AI_eat(BatchEnv *batch){
+    int num = batch->num;
+    int playerX[BATCH_MAX], playerY[BATCH_MAX], playerRadius[BATCH_MAX], playerThird[BATCH_MAX];
+    unsigned int eatsFood[LIVE_WORDS][BATCH_MAX];
+    unsigned char eatsAI[AI_NUM][BATCH_MAX];
+    unsigned int eatsPlayer[LIVE_WORDS][BATCH_MAX] = {{0}};
+    unsigned int eatenByPlayer[LIVE_WORDS][BATCH_MAX] = {{0}};
+    
+    for(int w = 0; w < num; w++){
+        playerX[w] = batch->worlds[w].player.xLocation;
+        playerY[w] = batch->worlds[w].player.yLocation;
+        playerRadius[w] = batch->worlds[w].player.radius;
+        playerThird[w] = playerRadius[w] / 3;
+    }
+    
+    for(int i = 0; i < AI_NUM; i++){
+        const int *x = batch->AIX[i];
+        const int *y = batch->AIY[i];
+        const int *radius = batch->AIRadius[i];
+        const int *third = batch->AIRadiusThird[i];
+        
+        memset(eatsFood, 0, sizeof(eatsFood));
+        for(int k = 0; k < FOOD_NUM; k++){
+            const int *foodX = batch->foodX[k];
+            const int *foodY = batch->foodY[k];
+            const int *alive = batch->foodAlive[k];
+            unsigned int *bits = eatsFood[k / 32];
+            
+            for(int w = 0; w < num; w++){
+                int dx = foodX[w] - x[w];
+                int dy = foodY[w] - y[w];
+                unsigned int hit = alive[w] & (dx*dx + dy*dy < radius[w] * radius[w]);
+                
+                bits[w] |= hit << (k % 32);
+            }
+        }
+        
+        for(int k = 0; k < AI_NUM; k++){
+            const int *preyX = batch->AIX[k];
+            const int *preyY = batch->AIY[k];
+            const int *preyThird = batch->AIRadiusThird[k];
+            unsigned char *eats = eatsAI[k];
+            
+            for(int w = 0; w < num; w++){
+                int dx = preyX[w] - x[w];
+                int dy = preyY[w] - y[w];
+                int reach = radius[w] - preyThird[w];
+                
+                eats[w] = (reach > 0) & (dx*dx + dy*dy < reach * reach);
+            }
+        }
+        
+        for(int w = 0; w < num; w++){
+            int dx = playerX[w] - x[w];
+            int dy = playerY[w] - y[w];
+            int distance = dx*dx + dy*dy;
+            int playerReach = playerRadius[w] - third[w];
+            int AIReach = radius[w] - playerThird[w];
+            
+            eatenByPlayer[i / 32][w] |= (unsigned int)((playerReach > 0) & (distance < playerReach * playerReach)) << (i % 32);
+            eatsPlayer[i / 32][w] |= (unsigned int)((AIReach > 0) & (distance < AIReach * AIReach)) << (i % 32);
+        }
+        
+        memcpy(batch->AIEatsFood[i], eatsFood, sizeof(eatsFood));
+        memcpy(batch->AIEatsAI[i], eatsAI, sizeof(eatsAI));
+    }
+    
+    memcpy(batch->playerEatsAI, eatenByPlayer, sizeof(eatenByPlayer));
+    memcpy(batch->AIEatsPlayer, eatsPlayer, sizeof(eatsPlayer));
+}
+
+// Function 131: Queue the eat events of world w from the masks, in the order of playerEatFood and detect_scheduled_eats
+// Food is walked in live order, the order foods are killed in decides where they respawn
+void batch_queue_eats(BatchEnv *batch, int w){
+    World *world = &batch->worlds[w];
+    
+    for(int f = 0; batch_any(batch->playerEatsFood, w) && f < world->liveFood.num; f++){
+        int k = world->liveFood.index[f];
+        if(batch_bit(batch->playerEatsFood, k, w))
+            queue_eat_event(ENTITY_PLAYER, 0, ENTITY_FOOD, k);
+    }
+    
+    for(int n = 0; n < world->liveAI.num; n++){
+        int i = world->liveAI.index[n];
+        
+        for(int f = 0; batch_any(batch->AIEatsFood[i], w) && f < world->liveFood.num; f++){
+            int k = world->liveFood.index[f];
+            if(batch_bit(batch->AIEatsFood[i], k, w))
+                queue_eat_event(ENTITY_AI, i, ENTITY_FOOD, k);
+        }
+        
+        for(int m = n + 1; m < world->liveAI.num; m++){
+            int k = world->liveAI.index[m];
+            
+            if(batch->AIEatsAI[k][i][w])
+                queue_eat_event(ENTITY_AI, k, ENTITY_AI, i);
+            else if(batch->AIEatsAI[i][k][w])
+                queue_eat_event(ENTITY_AI, i, ENTITY_AI, k);
         }
     }
+    
+    for(int n = 0; n < world->liveAI.num; n++){
+        int i = world->liveAI.index[n];
+        
+        if(batch_bit(batch->playerEatsAI, i, w))
+            queue_eat_event(ENTITY_PLAYER, 0, ENTITY_AI, i);
+        else if(batch_bit(batch->AIEatsPlayer, i, w))
+            queue_eat_event(ENTITY_AI, i, ENTITY_PLAYER, 0);
+    }
 }
 
-/* ***************************************** Text Drawing Functions Area ********************************************** */
+// Function 132: Bit of victim k in world w of an eat mask
+bool batch_bit(unsigned int mask[LIVE_WORDS][BATCH_MAX], int k, int w){
+    return (mask[k / 32][w] >> (k % 32)) & 1;
+}
 
-// Function 27:
-void video_text(int x, int y, char * text_ptr) {
-    int offset;
-    volatile char * character_buffer =(char *)FPGA_CHAR_BASE; // video character buffer
+// Function 133: Whether an eat mask has any victim in world w, most have none
+bool batch_any(unsigned int mask[LIVE_WORDS][BATCH_MAX], int w){
+    unsigned int bits = 0;
+    
+    for(int word = 0; word < LIVE_WORDS; word++)
+        bits |= mask[word][w];
+    return bits != 0;
+}
 
-    offset = (y << 7) + x;
-    while (*(text_ptr)) {
-        *(character_buffer + offset) =*(text_ptr); // write to the character buffer
-        ++text_ptr;
-        ++offset;
+// Function 75: Copy the food and AIs of one world into the interleaved arrays
+void batch_scatter(BatchEnv *batch, int w){
+    World *world = &batch->worlds[w];
+    
+    for(int k = 0; k < FOOD_NUM; k++){
+        batch->foodX[k][w] = world->food[k].xLocation;
+        batch->foodY[k][w] = world->food[k].yLocation;
+        batch->foodAlive[k][w] = !world->food[k].isEaten;
+    }
+    
+    for(int i = 0; i < AI_NUM; i++){
+        batch->AIX[i][w] = world->AI[i].xLocation;
+        batch->AIY[i][w] = world->AI[i].yLocation;
+        batch->AIRadius[i][w] = world->AI[i].radius;
+        batch->AIRadiusThird[i][w] = world->AI[i].radius / 3;
     }
 }
 
-void display_score(){
-    char str[20];
-    sprintf(str, "%d", player.score);
-    char text_top_left_first[40] = "Battle of Balls";
-    char text_top_left_second[40] = "Score:\0";
-    char text_bottom_middle[100] = "PRESS SPACE TO PAUSE / PRESS DIRECTION KEY TO CONTROL THE BALL\0";
-    strcat(text_top_left_second,str);
-    video_text(1, 1, text_top_left_first);
-    video_text(1, 3, text_top_left_second);
-    video_text(10, 58, text_bottom_middle);
+// Function 76: Move the player of a world as if the action's arrow key was held for one tick
+void batch_input(World *world, int action){
+    static const int actionKeys[5] = {0, ARROW_UP, ARROW_RIGHT, ARROW_LEFT, ARROW_DOWN};
+    
+    world->keys = actionKeys[action];
+    player_move(world);
 }
 
-void display_menutext(){
-        char text_top_row[40] = "BATTLE OF BALLS\0";//15
-        char text_middle_row[40] = "NOTE:WHITE BALLS IS PLAYER\0";//26
-        char text_bottom_row[40] = "PRESS ENTER TO START\0";//20
-        video_text(33, 29, text_top_row);
-        video_text(27, 31, text_middle_row);
-        video_text(30, 50, text_bottom_row);
+// Function 77: Observation of a world
+void batch_observe(World *world, Observation *observation){
+    observation->playerX = world->player.xLocation;
+    observation->playerY = world->player.yLocation;
+    observation->playerRadius = world->player.radius;
+    
+    for(int i = 0; i < AI_NUM; i++){
+        observation->AIX[i] = world->AI[i].xLocation;
+        observation->AIY[i] = world->AI[i].yLocation;
+        observation->AIRadius[i] = world->AI[i].isEaten ? 0 : world->AI[i].radius;
+    }
 }
 
-void display_pausetext(){
-    char pause_text_bottom_row[40] = "PRESS ENTER TO RESUME\0";
-    video_text(30, 31, pause_text_bottom_row);
+/* ***************************************** World Snapshot Functions Area ******************************************** */
+
+// Function 78: Write a world into a versioned little endian blob
+// Returns the number of bytes written, or -1 if the buffer is too small
+// Layout: "BOBS", version, flags, AI_NUM, FOOD_NUM, frameCount, randomSeed, score, CRC-32,
+//         player, AIs and foods as 17 byte records, live lists, AI targets,
+//         then the influence map if flagged
+int save_snapshot(World *world, unsigned char *buffer, int capacity){
+    if(capacity < SNAPSHOT_MAX_SIZE)
+        return -1;
+    
+    // The influence map only matters if the next update does not rebuild it.
+    // That is every frame but one in INFLUENCE_PERIOD, so most blobs carry the map's
+    // SNAPSHOT_MAP_SIZE bytes, 3007 bytes in all at the default sizes and 1207 without it
+    bool hasMap = (world->frameCount % INFLUENCE_PERIOD != 0);
+    unsigned char *cursor = buffer;
+    
+    *cursor++ = 'B';
+    *cursor++ = 'O';
+    *cursor++ = 'B';
+    *cursor++ = 'S';
+    *cursor++ = SNAPSHOT_VERSION;
+    *cursor++ = (world->endGame ? SNAPSHOT_END_GAME : 0) | (world->pauseGame ? SNAPSHOT_PAUSE_GAME : 0) | (hasMap ? SNAPSHOT_HAS_MAP : 0);
+    write_u16(&cursor, AI_NUM);
+    write_u16(&cursor, FOOD_NUM);
+    write_u32(&cursor, world->frameCount);
+    write_u32(&cursor, world->randomSeed);
+    write_u32(&cursor, world->player.score);
+    unsigned char *crcField = cursor;
+    write_u32(&cursor, 0);
+    
+    write_ball(&cursor, &world->player);
+    for(int i = 0; i < AI_NUM; i++)
+        write_ball(&cursor, &world->AI[i]);
+    for(int i = 0; i < FOOD_NUM; i++)
+        write_ball(&cursor, &world->food[i]);
+    
+    // Live list order decides iteration order, so it is part of the state
+    write_live(&cursor, &world->liveAI, AI_NUM);
+    write_live(&cursor, &world->liveFood, FOOD_NUM);
+    
+    // Targets decide who chases whom until the next refresh
+    for(int i = 0; i < AI_NUM; i++)
+        write_u16(&cursor, world->AITarget[i]);
+    
+    if(hasMap){
+        for(int row = 0; row < INFLUENCE_ROWS; row++){
+            for(int col = 0; col < INFLUENCE_COLS; col++){
+                write_u16(&cursor, world->influenceFood[row][col]);
+                write_u16(&cursor, world->influenceThreat[row][col]);
+                write_u16(&cursor, world->influenceTarget[row][col]);
+            }
+        }
+    }
+    
+    int length = cursor - buffer;
+    write_u32(&crcField, snapshot_crc(buffer, length));
+    return length;
 }
 
-void display_endingtext(){
-    char str[20];
-    sprintf(str, "%d", player.score);
-    char ending_text[40]="Your Final Score is:\0";
-    strcat(ending_text,str);
-    video_text(30, 50, ending_text);
+// Function 79: Replace a world with a blob from save_snapshot
+// Returns false and leaves the world alone if the blob does not fit this build
+bool restore_snapshot(World *world, const unsigned char *buffer, int length){
+    const unsigned char *cursor = buffer;
+    
+    if(length < SNAPSHOT_HEADER_SIZE || buffer[0] != 'B' || buffer[1] != 'O' || buffer[2] != 'B' || buffer[3] != 'S')
+        return false;
+    if(buffer[4] != SNAPSHOT_VERSION)
+        return false;
+    
+    int flags = buffer[5];
+    int expected = SNAPSHOT_HEADER_SIZE + (1 + AI_NUM + FOOD_NUM) * SNAPSHOT_BALL_SIZE + SNAPSHOT_LIVE_SIZE + SNAPSHOT_TARGET_SIZE + ((flags & SNAPSHOT_HAS_MAP) ? SNAPSHOT_MAP_SIZE : 0);
+    cursor += 6;
+    if(read_s16(&cursor) != AI_NUM || read_s16(&cursor) != FOOD_NUM || length < expected)
+        return false;
+    
+    // A blob that was cut, padded or flipped anywhere fails the CRC before any field is trusted
+    const unsigned char *crcField = buffer + SNAPSHOT_CRC_OFFSET;
+    if(read_u32(&crcField) != snapshot_crc(buffer, expected))
+        return false;
+    
+    // Everything is read into a copy of the world, which only replaces it once the whole blob checked out
+    // Kept off the stack, one per thread
+    static THREAD_LOCAL World restored;
+    restored = *world;
+    
+    restored.endGame = (flags & SNAPSHOT_END_GAME) != 0;
+    restored.pauseGame = (flags & SNAPSHOT_PAUSE_GAME) != 0;
+    restored.frameCount = read_u32(&cursor);
+    restored.randomSeed = read_u32(&cursor);
+    int score = read_u32(&cursor);
+    cursor += 4;
+    
+    // A player at WIN_RADIUS has already won, so only a finished game may hold one
+    if(score < 0 || !read_ball(&cursor, &restored.player, restored.endGame ? SNAPSHOT_MAX_RADIUS : WIN_RADIUS - 1))
+        return false;
+    restored.player.score = score;
+    for(int i = 0; i < AI_NUM; i++){
+        if(!read_ball(&cursor, &restored.AI[i], SNAPSHOT_MAX_RADIUS))
+            return false;
+    }
+    for(int i = 0; i < FOOD_NUM; i++){
+        if(!read_ball(&cursor, &restored.food[i], SNAPSHOT_MAX_RADIUS))
+            return false;
+    }
+    
+    if(!read_live(&cursor, &restored.liveAI, restored.AI, AI_NUM) || !read_live(&cursor, &restored.liveFood, restored.food, FOOD_NUM))
+        return false;
+    
+    for(int i = 0; i < AI_NUM; i++){
+        restored.AITarget[i] = read_s16(&cursor);
+        if(restored.AITarget[i] < -1 || restored.AITarget[i] >= AI_NUM)
+            return false;
+    }
+    
+    if(flags & SNAPSHOT_HAS_MAP){
+        for(int row = 0; row < INFLUENCE_ROWS; row++){
+            for(int col = 0; col < INFLUENCE_COLS; col++){
+                restored.influenceFood[row][col] = read_s16(&cursor);
+                restored.influenceThreat[row][col] = read_s16(&cursor);
+                restored.influenceTarget[row][col] = read_s16(&cursor);
+                if(restored.influenceTarget[row][col] < -1 || restored.influenceTarget[row][col] >= FOOD_NUM)
+                    return false;
+            }
+        }
+    }
+    
+    *world = restored;
+    scheduleStale = true;
+    return true;
 }
 
-/* *************************************** Score Update Functions Area ************************************************ */
+// Function 80: Snapshot to and from a file
+bool save_snapshot_file(World *world, const char *path){
+    unsigned char buffer[SNAPSHOT_MAX_SIZE];
+    int length = save_snapshot(world, buffer, SNAPSHOT_MAX_SIZE);
+    
+    FILE *file = fopen(path, "wb");
+    if(file == NULL)
+        return false;
+    
+    bool written = (fwrite(buffer, 1, length, file) == (size_t)length);
+    fclose(file);
+    return written;
+}
 
-// Function 28:
-void cleartext(){
-    for(int x=0;x<80;x++){
-        for(int y=0;y<60;y++){
-            video_text(x, y, " \0");
+bool restore_snapshot_file(World *world, const char *path){
+    unsigned char buffer[SNAPSHOT_MAX_SIZE];
+    
+    FILE *file = fopen(path, "rb");
+    if(file == NULL)
+        return false;
+    
+    int length = fread(buffer, 1, SNAPSHOT_MAX_SIZE, file);
+    fclose(file);
+    return restore_snapshot(world, buffer, length);
+}
+
+// Function 81: One ball as a 17 byte record
+void write_ball(unsigned char **cursor, Ball *ball){
+    *(*cursor)++ = ball->isEaten;
+    write_u16(cursor, (unsigned short int)ball->color);
+    write_u16(cursor, ball->radius);
+    write_u16(cursor, ball->xLocation);
+    write_u16(cursor, ball->yLocation);
+    write_u16(cursor, ball->lastXLocation);
+    write_u16(cursor, ball->lastYLocation);
+    write_u16(cursor, ball->xFraction);
+    write_u16(cursor, ball->yFraction);
+}
+
+// A record is only taken if the game could have written it: radius 1 to maxRadius,
+// centres on the playfield give or take SNAPSHOT_EDGE_SLACK and a colour the game draws balls in
+bool read_ball(const unsigned char **cursor, Ball *ball, int maxRadius){
+    int isEaten = *(*cursor)++;
+    ball->isEaten = isEaten;
+    ball->color = read_s16(cursor);
+    ball->radius = read_s16(cursor);
+    ball->xLocation = read_s16(cursor);
+    ball->yLocation = read_s16(cursor);
+    ball->lastXLocation = read_s16(cursor);
+    ball->lastYLocation = read_s16(cursor);
+    ball->xFraction = (unsigned short int)read_s16(cursor);
+    ball->yFraction = (unsigned short int)read_s16(cursor);
+    ball->score = 0;
+    
+    return isEaten <= 1 && ball->radius >= 1 && ball->radius <= maxRadius && palette_color(ball->color)
+        && on_playfield(ball->xLocation, ball->yLocation) && on_playfield(ball->lastXLocation, ball->lastYLocation);
+}
+
+bool on_playfield(int x, int y){
+    return x >= -SNAPSHOT_EDGE_SLACK && x <= RESOLUTION_X + SNAPSHOT_EDGE_SLACK && y >= -SNAPSHOT_EDGE_SLACK && y <= RESOLUTION_Y + SNAPSHOT_EDGE_SLACK;
+}
+
+// Function 135: The player's white or one of the colours balls spawn in
+bool palette_color(int value){
+    if(value == (short int)WHITE)
+        return true;
+    for(int n = 0; n < 9; n++){
+        if(value == color[n])
+            return true;
+    }
+    return false;
+}
+
+// Function 136: CRC-32 of the first length bytes of a blob, the CRC field itself left out
+unsigned int snapshot_crc(const unsigned char *buffer, int length){
+    build_crc_table();
+    
+    unsigned int crc = 0xFFFFFFFF;
+    for(int n = 0; n < length; n++){
+        if(n >= SNAPSHOT_CRC_OFFSET && n < SNAPSHOT_CRC_OFFSET + 4)
+            continue;
+        crc = crcTable[(crc ^ buffer[n]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// Function 89: Live list as a count and one slot per entity, unused slots are zero
+void write_live(unsigned char **cursor, LiveList *list, int capacity){
+    write_u16(cursor, list->num);
+    for(int n = 0; n < capacity; n++)
+        write_u16(cursor, (n < list->num) ? list->index[n] : 0);
+}
+
+// The list must name every ball that is not eaten, exactly once
+bool read_live(const unsigned char **cursor, LiveList *list, Ball *balls, int capacity){
+    int num = read_s16(cursor);
+    if(num < 0 || num > capacity)
+        return false;
+    
+    live_reset(list);
+    for(int n = 0; n < capacity; n++){
+        int index = read_s16(cursor);
+        if(n >= num)
+            continue;
+        if(index < 0 || index >= capacity || balls[index].isEaten || (list->alive[index / 32] & (1u << (index % 32))))
+            return false;
+        live_insert(list, index);
+    }
+    
+    for(int i = 0; i < capacity; i++){
+        if(!balls[i].isEaten && !(list->alive[i / 32] & (1u << (i % 32))))
+            return false;
+    }
+    return true;
+}
+
+// Function 82: Little endian fields
+void write_u16(unsigned char **cursor, int value){
+    *(*cursor)++ = value & 0xFF;
+    *(*cursor)++ = (value >> 8) & 0xFF;
+}
+
+void write_u32(unsigned char **cursor, unsigned int value){
+    write_u16(cursor, value & 0xFFFF);
+    write_u16(cursor, value >> 16);
+}
+
+int read_s16(const unsigned char **cursor){
+    int value = (*cursor)[0] | ((*cursor)[1] << 8);
+    *cursor += 2;
+    return (short int)value;
+}
+
+unsigned int read_u32(const unsigned char **cursor){
+    unsigned int low = (unsigned short int)read_s16(cursor);
+    unsigned int high = (unsigned short int)read_s16(cursor);
+    return low | (high << 16);
+}
+
+/* ****************************************** Golden Frame Functions Area ********************************************* */
+
+// Function 94: Deterministic replay that captures or checks the back buffer at goldenFrames
+// The seed and the held keys are fixed, so every run draws the same frames
+// unless the renderer changed
+void run_golden_replay(){
+    reset_world(&game, GOLDEN_SEED);
+    
+    // Always the same back buffer, never shown, so that the tile history is the same too
+    pixel_buffer_start = SDRAM_BASE;
+    invalidate_tiles();
+    
+    int check = 0;
+    for(int frame = 0; check < GOLDEN_CHECK_NUM; frame++){
+        take_snapshot(&game);
+        plot_game();
+        
+        if(frame == goldenFrames[check]){
+#if GOLDEN_CAPTURE
+            capture_frame(check);
+#endif
+            compare_frame(check, frame);
+#if GOLDEN_DUMP
+            dump_frame_ppm(frame);
+#endif
+            check++;
         }
+        
+        // Frame N+1, the player turns every 32 frames
+        game.keys = goldenKeys[(frame / 32) % 8];
+        step_world(&game);
+        
+        if(game.endGame)
+            reset_world(&game, game.randomSeed);
     }
+    
+    arena_report(&frameArena);
+    arena_report(&roundArena);
 }
 
-//Function 29: upadate score
-void update_score(){
-    player.score=(player.radius-5)*10;
+// Function 137: Table of the reflected CRC-32 polynomial, built on first use
+void build_crc_table(){
+    if(crcTable[1] != 0)
+        return;
+    for(unsigned int n = 0; n < 256; n++){
+        unsigned int c = n;
+        for(int k = 0; k < 8; k++)
+            c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+        crcTable[n] = c;
+    }
 }
 
-/* ******************************************* Open Scene & Ending Ssene Functions Area ******************************************* */
+// Function 95: CRC-32 of the visible part of the back buffer
+unsigned int frame_crc(){
+    build_crc_table();
+    
+    unsigned int crc = 0xFFFFFFFF;
+    for(int y = 0; y < RESOLUTION_Y; y++){
+        for(int x = 0; x < RESOLUTION_X; x++){
+            unsigned short int pixel = *(unsigned short int *)(pixel_buffer_start + (y << 10) + (x << 1));
+            crc = crcTable[(crc ^ pixel) & 0xFF] ^ (crc >> 8);
+            crc = crcTable[(crc ^ (pixel >> 8)) & 0xFF] ^ (crc >> 8);
+        }
+    }
+    return ~crc;
+}
 
-// Function 30: Open Scene
-void opening(){
-    int x = RESOLUTION_X/2;
-    int y = RESOLUTION_Y/2;
-    short int color = WHITE;
+// Function 96: Store the back buffer as golden frame number slot
+void capture_frame(int slot){
+    unsigned short int *golden = (unsigned short int *)GOLDEN_STORE_BASE + slot * GOLDEN_FRAME_SIZE;
     
-    // Draw Circles
-    for(int r = RESOLUTION_X/2; r > 5; r--){
-        int count = 0;
-        int d = 3-2*r;
+    for(int y = 0; y < RESOLUTION_Y; y++){
+        for(int x = 0; x < RESOLUTION_X; x++)
+            golden[y * RESOLUTION_X + x] = *(unsigned short int *)(pixel_buffer_start + (y << 10) + (x << 1));
+    }
+}
+
+// Pixels that differ from golden frame number slot, with the box around them
+void compare_frame(int slot, int frame){
+    unsigned short int *golden = (unsigned short int *)GOLDEN_STORE_BASE + slot * GOLDEN_FRAME_SIZE;
+    int diffs = 0;
+    int left = RESOLUTION_X, right = -1, top = RESOLUTION_Y, bottom = -1;
+    
+    for(int y = 0; y < RESOLUTION_Y; y++){
+        for(int x = 0; x < RESOLUTION_X; x++){
+            if(golden[y * RESOLUTION_X + x] == *(unsigned short int *)(pixel_buffer_start + (y << 10) + (x << 1)))
+                continue;
+            
+            diffs++;
+            if(x < left) left = x;
+            if(x > right) right = x;
+            if(y < top) top = y;
+            if(y > bottom) bottom = y;
+        }
+    }
+    
+    char report[100];
+    if(diffs == 0)
+        sprintf(report, "frame %d crc %08x exact\n", frame, frame_crc());
+    else
+        sprintf(report, "frame %d crc %08x %d pixels differ in (%d,%d)-(%d,%d)\n", frame, frame_crc(), diffs, left, top, right, bottom);
+    jtag_print(report);
+}
+
+// Function 97: Back buffer as a plain text PPM, waits for the UART so nothing is lost
+void dump_frame_ppm(int frame){
+    char text[40];
+    
+    sprintf(text, "# frame %d\nP3\n%d %d\n255\n", frame, RESOLUTION_X, RESOLUTION_Y);
+    for(char *c = text; *c; c++)
+        jtag_put(*c);
+    
+    for(int y = 0; y < RESOLUTION_Y; y++){
+        for(int x = 0; x < RESOLUTION_X; x++){
+            unsigned short int pixel = *(unsigned short int *)(pixel_buffer_start + (y << 10) + (x << 1));
+            
+            // RGB565 widened to 8 bits per channel
+            sprintf(text, "%d %d %d\n", ((pixel >> 11) & 0x1F) << 3, ((pixel >> 5) & 0x3F) << 2, (pixel & 0x1F) << 3);
+            for(char *c = text; *c; c++)
+                jtag_put(*c);
+        }
+    }
+}
+
+void jtag_put(char c){
+    while((*(jtag_ptr + 1) & 0xFFFF0000) == 0)
+        ;
+    *(jtag_ptr) = c;
+}
+
+/* ********************************************* Audio Functions Area ************************************************* */
+
+// Function 59: Build the wavetables, clear the codec FIFO and start the music
+void audio_init(){
+    for(int i = 0; i < SINE_TABLE_SIZE; i++)
+        sineTable[i] = (short int)(32767 * sin(2 * M_PI * i / SINE_TABLE_SIZE));
+    
+    // Sound effects are swept sines with a falling envelope
+    unsigned int phase = 0;
+    for(int i = 0; i < SFX_EAT_SAMPLES; i++){
+        int frequency = 600 + 600 * i / SFX_EAT_SAMPLES;
+        int envelope = 256 - 256 * i / SFX_EAT_SAMPLES;
         
-        while(r > count){
-            draw_line(-count+x, r+y, count+x, r+y, color);
-            draw_line(-r+x, count+y, r+x, count+y, color);
-            draw_line(-count+x, -r+y, count+x, -r+y, color);
-            draw_line(-r+x, -count+y, r+x, -count+y, color);
+        phase += (unsigned int)(((long long)frequency * SINE_TABLE_SIZE << 16) / AUDIO_SAMPLE_RATE);
+        sfxEat[i] = sineTable[(phase >> 16) % SINE_TABLE_SIZE] * envelope / 256;
+    }
+    phase = 0;
+    for(int i = 0; i < SFX_GULP_SAMPLES; i++){
+        int frequency = 400 - 250 * i / SFX_GULP_SAMPLES;
+        int envelope = 256 - 256 * i / SFX_GULP_SAMPLES;
+        
+        phase += (unsigned int)(((long long)frequency * SINE_TABLE_SIZE << 16) / AUDIO_SAMPLE_RATE);
+        sfxGulp[i] = sineTable[(phase >> 16) % SINE_TABLE_SIZE] * envelope / 256;
+    }
+    
+    for(int i = 0; i < AUDIO_VOICE_NUM; i++)
+        voices[i].active = false;
+    audioRingHead = 0;
+    audioRingTail = 0;
+    
+    // Music loops over the sine table, music_next_note changes the pitch
+    voices[0].table = sineTable;
+    voices[0].length = SINE_TABLE_SIZE;
+    voices[0].loop = true;
+    voices[0].volume = MUSIC_VOLUME;
+    voices[0].phase = 0;
+    musicNote = -1;
+    musicSamplesLeft = 0;
+    
+    // Clear the write FIFO
+    *(audio_ptr) = 0x8;
+    *(audio_ptr) = 0x0;
+}
+
+// Function 60: Mix what the ring can hold, then give the codec what its FIFO can take
+// Never waits on the codec, so it can be called anywhere in a frame
+void audio_update(){
+    audio_mix();
+    
+    int fifospace = *(audio_ptr + 1);
+    int rightSpace = (fifospace >> 16) & 0xFF;
+    int leftSpace = (fifospace >> 24) & 0xFF;
+    int space = (rightSpace < leftSpace) ? rightSpace : leftSpace;
+    
+    while(space > 0 && audioRingTail != audioRingHead){
+        int sample = audioRing[audioRingTail & (AUDIO_RING_SIZE - 1)] * 65536;
+        
+        *(audio_ptr + 2) = sample;
+        *(audio_ptr + 3) = sample;
+        audioRingTail++;
+        space--;
+    }
+}
+
+// Function 61: Keep the ring filled with the sum of all voices
+void audio_mix(){
+    while(audioRingHead - audioRingTail < AUDIO_LEAD_SAMPLES){
+        if(musicSamplesLeft == 0)
+            music_next_note();
+        musicSamplesLeft--;
+        
+        int mixed = 0;
+        for(int i = 0; i < AUDIO_VOICE_NUM; i++){
+            Voice *voice = &voices[i];
+            if(!voice->active)
+                continue;
             
-            if(d < 0){
-                d = d + 4*count + 6;
-            }else{
-                d = d + 4*(count - r) + 10;
-                r--;
+            int index = voice->phase >> 16;
+            if(index >= voice->length){
+                if(!voice->loop){
+                    voice->active = false;
+                    continue;
+                }
+                voice->phase -= (unsigned int)voice->length << 16;
+                index -= voice->length;
             }
-            count++;
+            
+            mixed += voice->table[index] * voice->volume >> 8;
+            voice->phase += voice->step;
         }
         
-        wait_for_vsync(); // swap front and back buffers on VGA vertical sync
-        pixel_buffer_start = *(pixel_ctrl_ptr + 1); // new back buffer
-        
-        // Erase any boxes and lines that were drawn in the last iteration
-        clear_screen();
+        if(mixed > 32767) mixed = 32767;
+        if(mixed < -32768) mixed = -32768;
+        audioRing[audioRingHead & (AUDIO_RING_SIZE - 1)] = mixed;
+        audioRingHead++;
     }
 }
 
-/* ******************************************* Tool Functions Area **************************************************** */
+// Function 62: Start a sound effect on a free voice, or on the oldest effect
+void audio_play_sfx(int sfx){
+    int chosen = 1;
+    for(int i = 1; i < AUDIO_VOICE_NUM; i++){
+        if(!voices[i].active){
+            chosen = i;
+            break;
+        }
+        if(voices[i].phase > voices[chosen].phase)
+            chosen = i;
+    }
+    
+    Voice *voice = &voices[chosen];
+    voice->table = (sfx == SFX_EAT) ? sfxEat : sfxGulp;
+    voice->length = (sfx == SFX_EAT) ? SFX_EAT_SAMPLES : SFX_GULP_SAMPLES;
+    voice->phase = 0;
+    voice->step = 1 << 16;
+    voice->volume = SFX_VOLUME;
+    voice->loop = false;
+    voice->active = true;
+}
+
+// Function 63: Move the music voice to the next note of the melody
+void music_next_note(){
+    musicNote = (musicNote + 1) % 16;
+    musicSamplesLeft = MUSIC_NOTE_SAMPLES;
+    
+    voices[0].active = (melody[musicNote] != 0);
+    voices[0].step = (unsigned int)(((long long)melody[musicNote] * SINE_TABLE_SIZE << 16) / AUDIO_SAMPLE_RATE);
+}
+
+/* ********************************************* Arena Functions Area ************************************************* */
+
+// Function 114: Bytes from an arena, never NULL
+// Callers write through the pointer at once, so a full arena stops the program with a report instead
+void *arena_alloc(Arena *arena, int bytes){
+    int start = (arena->used + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+    
+    if(start + bytes > arena->size){
+        char report[100];
+        sprintf(report, "%s arena full: %d more bytes with %d of %d in use\n", arena->name, bytes, arena->used, arena->size);
+        jtag_print(report);
+        while(true);
+    }
+    
+    arena->used = start + bytes;
+    if(arena->used > arena->highWater)
+        arena->highWater = arena->used;
+    return arena->memory + start;
+}
+
+// Everything allocated from the arena is gone
+void arena_reset(Arena *arena){
+    arena->used = 0;
+}
+
+// Scratch taken after a mark is given back by releasing the mark
+int arena_mark(Arena *arena){
+    return arena->used;
+}
+
+void arena_release(Arena *arena, int mark){
+    arena->used = mark;
+}
+
+// Function 115: High water mark of an arena on the JTAG UART
+void arena_report(Arena *arena){
+    char report[80];
+    sprintf(report, "%s arena: %d of %d bytes at most\n", arena->name, arena->highWater, arena->size);
+    jtag_print(report);
+}
 
-// Function 30: Find Distance Between Balls
-float findDistance(Ball ball1, Ball ball2){
-    return sqrt((ball1.xLocation - ball2.xLocation) * (ball1.xLocation - ball2.xLocation) + (ball1.yLocation - ball2.yLocation) * (ball1.yLocation - ball2.yLocation));
+// Function 116: Buffers whose size is fixed for a round
+void initial_round_memory(){
+    arena_reset(&roundArena);
+    foodSet = arena_alloc(&roundArena, sizeof(CircleSet));
+    pairNext = arena_alloc(&roundArena, SCHEDULE_PAIRS * sizeof(int));
+    pairPrev = arena_alloc(&roundArena, SCHEDULE_PAIRS * sizeof(int));
+    pairDue = arena_alloc(&roundArena, SCHEDULE_PAIRS * sizeof(int));
+    scheduleStale = true;
 }
 
-float findDistanceForPlayer(Ball ball1, int xLocation, int yLocation){
-    return sqrt((xLocation - ball1.xLocation) * (xLocation - ball1.xLocation) + (yLocation - ball1.yLocation) * (yLocation - ball1.yLocation));
+// Function 138: Point the arenas of this thread at its own memory, once per thread before any world is stepped
+// A worker may step a world another thread started, so the round buffers are laid out here as well
+void initial_thread_memory(){
+    frameArena.memory = frameArenaMemory;
+    roundArena.memory = roundArenaMemory;
+    initial_round_memory();
 }
 
+/* ******************************************* Tool Functions Area **************************************************** */
+
 // Function 31: the ball is overlap with the player
-bool overlapPlayer(Ball ball){
-    if(((ball.xLocation - ball.radius) < (player.xLocation + player.radius)) && ((ball.xLocation + ball.radius) > (player.xLocation - player.radius))){
-        if(((ball.yLocation - ball.radius) < (player.yLocation + player.radius)) && ((ball.yLocation + ball.radius) > (player.yLocation - player.radius))){
+bool overlapPlayer(World *world, Ball ball){
+    if(((ball.xLocation - ball.radius) < (world->player.xLocation + world->player.radius)) && ((ball.xLocation + ball.radius) > (world->player.xLocation - world->player.radius))){
+        if(((ball.yLocation - ball.radius) < (world->player.yLocation + world->player.radius)) && ((ball.yLocation + ball.radius) > (world->player.yLocation - world->player.radius))){
             return true;
         }
     }
@@ -1282,10 +4373,10 @@ bool overlapPlayer(Ball ball){
 }
 
 // Function 32: New balls won't overlap with old balls
-bool overlapAI(Ball ball){
+bool overlapAI(World *world, Ball ball){
     for(int i = 0; i < AI_NUM; i++){
-        if(((ball.xLocation - ball.radius) < (AI[i].xLocation + AI[i].radius)) && ((ball.xLocation + ball.radius) > (AI[i].xLocation - AI[i].radius))){
-            if(((ball.yLocation - ball.radius) < (AI[i].yLocation + AI[i].radius)) && ((ball.yLocation + ball.radius) > (AI[i].yLocation - AI[i].radius))){
+        if(((ball.xLocation - ball.radius) < (world->AI[i].xLocation + world->AI[i].radius)) && ((ball.xLocation + ball.radius) > (world->AI[i].xLocation - world->AI[i].radius))){
+            if(((ball.yLocation - ball.radius) < (world->AI[i].yLocation + world->AI[i].radius)) && ((ball.yLocation + ball.radius) > (world->AI[i].yLocation - world->AI[i].radius))){
                 return true;
             }
         }
@@ -1293,40 +4384,38 @@ bool overlapAI(Ball ball){
     return false;
 }
 
-// Function 33: Swap
-void swap(int* a, int* b){
-    int temp = *a;
-    *a = *b;
-    *b = temp;
+// Function 71: Random numbers owned by the world, so that every world replays the same way
+int game_rand(World *world){
+    world->randomSeed = world->randomSeed * 1103515245 + 12345;
+    return (world->randomSeed >> 16) & 0x7FFF;
 }
 
-void draw_pic_a(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,battle_of_balls[j-y][i-x]);
-        }
-    }
-}
-void draw_pic_b(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,note[j-y][i-x]);
-        }
-    }
-}
-void draw_pic_c(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,start[j-y][i-x]);
-        }
-    }
+void game_srand(World *world, unsigned int seed){
+    world->randomSeed = seed;
 }
 
+// Function 134: Square root rounded down, one result bit per step without floating point
+int int_sqrt(int value){
+    int root = 0;
+    int bit = 1 << 30;
     
-void draw_pic_e(int m,int n,uint16_t array[m][n],int x,int y){
-    for(int i=x;i<x+n;i++){
-        for(int j=y;j<y+m;j++){
-            plot_pixel(i,j,gameIsOver[j-y][i-x]);
+    while(bit > value)
+        bit >>= 2;
+    while(bit != 0){
+        if(value >= root + bit){
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }else{
+            root >>= 1;
         }
+        bit >>= 2;
     }
+    return root;
+}
+
+// Function 33: Swap
+void swap(int* a, int* b){
+    int temp = *a;
+    *a = *b;
+    *b = temp;
 }